@@ -1,5 +1,6 @@
 #include <string>
 #include <algorithm>
+#include <map>
 #include "lib_math.h"
 #include "fin_date.h"
 
@@ -62,13 +63,12 @@ std::tuple<int, std::string> fin_date::decompose_freq(const std::string& freq_st
     }
     else
     {
-        std::size_t pos;
+        // amounts might have more than one digit, e.g. "10Y3M"
+        std::size_t pos_yr = freq_str.find(freq_units_sep[0]);
+        int freq_amt_yr = std::stoi(freq_str.substr(0, pos_yr));
 
-        pos = freq_str.find(freq_units_sep[0]);
-        int freq_amt_yr = std::stoi(freq_str.substr(pos - 1, 1));
-
-        pos = freq_str.find(freq_units_sep[1]);
-        int freq_amt_mth = std::stoi(freq_str.substr(pos - 1, 1));
+        std::size_t pos_mth = freq_str.find(freq_units_sep[1]);
+        int freq_amt_mth = std::stoi(freq_str.substr(pos_yr + 1, pos_mth - pos_yr - 1));
 
         freq_amt = freq_amt_yr * 12 + freq_amt_mth;
         freq_unit = "M";
@@ -249,8 +249,8 @@ double fin_date::day_count_method(const lib_date::myDate& date_begin, const lib_
         // calculate year fraction
         year_fraction = calc_year_fraction(day1, month1, year1, day2, month2, year2);
     }
-    // 30/360 US
-    else if (dcm.compare("30US_360") == 0)
+    // 30/360 US; "U30_360" is an alternative name used in generator definitions
+    else if ((dcm.compare("30US_360") == 0) || (dcm.compare("U30_360") == 0))
     {
 
         // determine if date1 is the last February day
@@ -429,9 +429,108 @@ std::vector<double> fin_date::day_count_method(const std::vector<lib_date::myDat
     return yr_fracs;
 }
 
+// generate public holidays of a single country calendar
+static std::vector<lib_date::myDate> get_cnty_holidays(const std::string& cnty, const std::size_t& year_begin, const std::size_t& year_end)
+{
+    if (cnty.compare("cz") == 0)
+        return lib_date::get_holidays_cz(year_begin, year_end);
+    else if (cnty.compare("de") == 0)
+        return lib_date::get_holidays_de(year_begin, year_end);
+    else if ((cnty.compare("eu") == 0) || (cnty.compare("target") == 0))
+        return lib_date::get_holidays_eu(year_begin, year_end);
+    else if ((cnty.compare("uk") == 0) || (cnty.compare("london") == 0))
+        return lib_date::get_holidays_uk(year_begin, year_end);
+    else if (cnty.compare("us") == 0)
+        return lib_date::get_holidays_us(year_begin, year_end);
+    else
+        throw std::invalid_argument((std::string)__func__ + ": '" + cnty + "' is not a supported calendar!");
+}
+
+// get public holidays calendar; calendars are cached per thread as their generation is expensive
+const std::vector<lib_date::myDate>& fin_date::get_holidays(const std::string& cnty, const std::size_t& year_begin, const std::size_t& year_end)
+{
+    // calendars already generated by the current thread
+    thread_local std::map<std::tuple<std::string, std::size_t, std::size_t>, std::vector<lib_date::myDate>> calendars;
+
+    // return cached calendar if available
+    std::tuple<std::string, std::size_t, std::size_t> key = {cnty, year_begin, year_end};
+    auto calendar = calendars.find(key);
+    if (calendar != calendars.end())
+        return calendar->second;
+
+    // split calendar name into country calendars; joint calendars are composed of two letter codes, e.g. "usukeu"
+    std::vector<std::string> cntys;
+    std::vector<std::string> cntys_supported = {"cz", "de", "eu", "uk", "us"};
+    if ((cnty.compare("target") == 0) || (cnty.compare("london") == 0))
+        cntys.push_back(cnty);
+    else if ((cnty.size() > 0) && (cnty.size() % 2 == 0))
+    {
+        for (std::size_t pos = 0; pos < cnty.size(); pos += 2)
+            cntys.push_back(cnty.substr(pos, 2));
+        for (std::string cnty_aux : cntys)
+        {
+            if (std::find(cntys_supported.begin(), cntys_supported.end(), cnty_aux) == cntys_supported.end())
+            {
+                cntys.clear();
+                break;
+            }
+        }
+    }
+
+    // merge country calendars; unknown calendar falls back to weekends only
+    std::vector<lib_date::myDate> holidays;
+    if (cntys.size() == 0)
+        holidays = lib_date::get_weekends(year_begin, year_end);
+    for (std::string cnty_aux : cntys)
+    {
+        std::vector<lib_date::myDate> holidays_aux = get_cnty_holidays(cnty_aux, year_begin, year_end);
+        holidays.insert(holidays.end(), holidays_aux.begin(), holidays_aux.end());
+    }
+
+    // sort holidays and drop duplicities coming from joint calendars
+    std::sort(holidays.begin(), holidays.end(), [](const lib_date::myDate& date1, const lib_date::myDate& date2) {return date1.get_days_no() < date2.get_days_no();});
+    holidays.erase(std::unique(holidays.begin(), holidays.end(), [](const lib_date::myDate& date1, const lib_date::myDate& date2) {return date1.get_days_no() == date2.get_days_no();}), holidays.end());
+
+    // store calendar into cache and return it
+    return calendars.emplace(key, holidays).first->second;
+}
+
+// get regular coupon dates; schedules are cached per thread as curves are often bootstrapped again as of the same date
+std::vector<lib_date::myDate> fin_date::get_cpn_dates(const lib_date::myDate& date_spot, const std::tuple<int, std::string>& freq, const std::size_t& cpns_no, const std::string& cnty, const std::size_t& year_begin, const std::size_t& year_end, const std::string& drm)
+{
+    // schedules already generated by the current thread
+    thread_local std::map<std::tuple<std::size_t, int, std::string, std::string, std::size_t, std::size_t, std::string>, std::vector<lib_date::myDate>> schedules;
+
+    // spot dates change with the bootstrapped date, e.g. in a historical batch, so the cache is emptied once it is full instead of growing without bound
+    const std::size_t schedules_max = 256;
+    if (schedules.size() >= schedules_max)
+        schedules.clear();
+
+    // cached schedule is extended by the missing coupon dates only
+    std::vector<lib_date::myDate>& dates = schedules[{date_spot.get_days_no(), std::get<0>(freq), std::get<1>(freq), cnty, year_begin, year_end, drm}];
+    if (dates.size() < cpns_no)
+    {
+        const std::vector<lib_date::myDate>& holidays = fin_date::get_holidays(cnty, year_begin, year_end);
+        for (std::size_t cpn_no = dates.size() + 1; cpn_no <= cpns_no; cpn_no++)
+        {
+            // coupon dates are derived from spot date to avoid accumulation of rolling adjustments
+            lib_date::myDate date_cpn = date_spot;
+            date_cpn.add(fin_date::compose_freq({(int)cpn_no * std::get<0>(freq), std::get<1>(freq)}));
+            fin_date::date_rolling(date_cpn, holidays, drm);
+            dates.push_back(date_cpn);
+        }
+    }
+
+    return dates;
+}
+
 // implementation of date rolling; see https://en.wikipedia.org/wiki/Date_rolling
-void fin_date::date_rolling(lib_date::myDate& date, const std::vector<lib_date::myDate>& holidays, const std::string& drm = "following")
+void fin_date::date_rolling(lib_date::myDate& date, const std::vector<lib_date::myDate>& holidays, const std::string& drm_str = "following")
 {
+    // generator definitions might use spaces instead of underscores, e.g. "modified following"
+    std::string drm = drm_str;
+    std::replace(drm.begin(), drm.end(), ' ', '_');
+
     // following business day
     if (drm.compare("following") == 0)
     {
@@ -485,18 +584,7 @@ std::tuple<std::vector<lib_date::myDate>, std::vector<lib_date::myDate>> fin_dat
     // determine holidays calendar
     std::size_t year_start = date_start.get_year();
     std::size_t year_end = year_start + 100;
-    std::vector<lib_date::myDate> holidays;
-
-    if (cnty.compare("cz") == 0)
-        holidays = lib_date::get_holidays_cz(year_start, year_end);
-    else if (cnty.compare("de") == 0)
-        holidays = lib_date::get_holidays_de(year_start, year_end);
-    else if (cnty.compare("uk") == 0)
-        holidays = lib_date::get_holidays_uk(year_start, year_end);
-    else if (cnty.compare("us") == 0)
-        holidays = lib_date::get_holidays_us(year_start, year_end);
-    else
-        holidays = lib_date::get_weekends(year_start, year_end);
+    const std::vector<lib_date::myDate>& holidays = fin_date::get_holidays(cnty, year_start, year_end);
 
     // go through date frequencies
     std::vector<lib_date::myDate> dates_begin;
@@ -562,8 +650,7 @@ std::tuple<std::vector<lib_date::myDate>, std::vector<lib_date::myDate>> fin_dat
     }
 
     // roll end dates; the begining dates should be OK as they are addjusted for working days in ON and TN part of the code
-    for (unsigned short idx = 0; idx < dates_end.size(); idx++)
-        date_rolling(dates_end, holidays, drm);
+    date_rolling(dates_end, holidays, drm);
 
     // return date serie
     return std::tuple<std::vector<lib_date::myDate>, std::vector<lib_date::myDate>>({dates_begin, dates_end});
@@ -45,7 +45,7 @@ namespace fin_date
      * 
      * @param date_begin Begining date.
      * @param date_end End date.
-     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360", "ACT_360", "ACT_365" and "ACT_ACT".
+     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360" (alias "U30_360"), "ACT_360", "ACT_365" and "ACT_ACT".
      * @return double Year fraction.
      */
     double day_count_method(const lib_date::myDate& date_begin, const lib_date::myDate& date_end, const std::string& dcm);
@@ -89,7 +89,7 @@ namespace fin_date
      * @brief Determine year fractions between dates organized in a vector using a specified day count method. For more details see https://en.wikipedia.org/wiki/Day_count_convention.
      * 
      * @param dates Vector of dates.
-     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360", "ACT_360", "ACT_365" and "ACT_ACT".
+     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360" (alias "U30_360"), "ACT_360", "ACT_365" and "ACT_ACT".
      * @return std::vector<double> Vector of year fractions; the vector is one element shorter compared to vector of dates.
      */
     std::vector<double> day_count_method(const std::vector<lib_date::myDate>& dates, const std::string& dcm);
@@ -99,7 +99,7 @@ namespace fin_date
      * 
      * @param date_ref Reference date.
      * @param dates Vector of dates.
-     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360", "ACT_360", "ACT_365" and "ACT_ACT".
+     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360" (alias "U30_360"), "ACT_360", "ACT_365" and "ACT_ACT".
      * @return std::vector<double> Vector of year fractions; the vector is of the same length as vector of dates.
      */
     std::vector<double> day_count_method(const lib_date::myDate& date_ref, const std::vector<lib_date::myDate>& dates, const std::string& dcm);
@@ -109,17 +109,41 @@ namespace fin_date
      * 
      * @param dates_begin Vector of dates defining beging of the period.
      * @param dates_end  Vector of dates defining end of the period.
-     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360", "ACT_360", "ACT_365" and "ACT_ACT".
+     * @param dcm Day count method to be applied; supported values are "30_360", "30US_360" (alias "U30_360"), "ACT_360", "ACT_365" and "ACT_ACT".
      * @return std::vector<double> Vector of year fractions; the vector is of the same length as the two vector of dates.
      */
     std::vector<double> day_count_method(const std::vector<lib_date::myDate>& dates_begin, const std::vector<lib_date::myDate>& dates_end, const std::string& dcm);
 
+    /**
+     * @brief Get public holidays of a calendar. Calendars are generated once and cached per thread, i.e. the returned reference stays valid for the lifetime of the calling thread.
+     * 
+     * @param cnty Calendar name; supported values are "cz", "de", "eu" (alias "target"), "uk" (alias "london"), "us" and their joint calendars, e.g. "usukeu". Unknown calendars fall back to weekends, see lib_date::get_weekends().
+     * @param year_begin Begining year.
+     * @param year_end End year.
+     * @return const std::vector<lib_date::myDate>& Vector of public holidays sorted in ascending order.
+     */
+    const std::vector<lib_date::myDate>& get_holidays(const std::string& cnty, const std::size_t& year_begin, const std::size_t& year_end);
+
+    /**
+     * @brief Get regular coupon dates following a spot date, each derived from the spot date and rolled to a working day. Schedules are generated once and cached per thread together with calendars, i.e. a curve bootstrapped again as of the same date, e.g. with bumped quotes, reuses its coupon dates. The cache holds at most 256 schedules and is emptied once full; dates are returned by value as a later call might extend or drop the cached ones.
+     * 
+     * @param date_spot Spot date.
+     * @param freq Decomposed coupon frequency, e.g. [3, "M"].
+     * @param cpns_no Minimum number of coupon dates.
+     * @param cnty Calendar name, see get_holidays().
+     * @param year_begin Begining year of the calendar.
+     * @param year_end End year of the calendar.
+     * @param drm Day rolling method.
+     * @return std::vector<lib_date::myDate> Vector of at least cpns_no coupon dates sorted in ascending order.
+     */
+    std::vector<lib_date::myDate> get_cpn_dates(const lib_date::myDate& date_spot, const std::tuple<int, std::string>& freq, const std::size_t& cpns_no, const std::string& cnty, const std::size_t& year_begin, const std::size_t& year_end, const std::string& drm);
+
     /**
      * @brief Roll the date to deal with weekends and public holidays if necessary. For more details see https://en.wikipedia.org/wiki/Date_rolling.
      * 
      * @param date Date to be rolled for weekend / public holidays if necessary.
      * @param holidays List of public holidays.
-     * @param drm Date rolling method; suppoted values are "following", "modified_following", "previous" and "modified_previous".
+     * @param drm Date rolling method; suppoted values are "following", "modified_following", "previous" and "modified_previous"; spaces might be used instead of underscores.
      */
     void date_rolling(lib_date::myDate& date, const std::vector<lib_date::myDate>& holidays, const std::string& drm);
 
@@ -128,7 +152,7 @@ namespace fin_date
      * 
      * @param dates Vector of dates to be rolled for weekend / public holidays if necessary.
      * @param holidays List of public holidays.
-     * @param drm Date rolling method; suppoted values are "following", "modified_following", "previous" and "modified_previous".
+     * @param drm Date rolling method; suppoted values are "following", "modified_following", "previous" and "modified_previous"; spaces might be used instead of underscores.
      */
     void date_rolling(std::vector<lib_date::myDate>& dates, const std::vector<lib_date::myDate>& holidays, const std::string& drm);
 
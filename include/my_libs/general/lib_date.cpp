@@ -555,6 +555,46 @@ std::vector<lib_date::myDate> lib_date::get_holidays_de(const std::size_t& year_
 
 }
 
+// TARGET2 closing days used by euro money markets
+std::vector<lib_date::myDate> lib_date::get_holidays_eu(const std::size_t& year_begin, const std::size_t& year_end)
+{
+    std::vector<lib_date::myDate> holidays;
+    std::size_t year_curt = year_begin;
+    while (year_curt <= year_end)
+    {
+        // New Year's Day
+        lib_date::myDate new_year = lib_date::myDate(year_curt * 10000 + 1 * 100 + 1);
+        holidays.push_back(new_year);
+
+        // Good Friday
+        lib_date::myDate good_friday = lib_date::get_easter_friday(year_curt);
+        holidays.push_back(good_friday);
+
+        // Easter Monday
+        lib_date::myDate easter_monday = lib_date::get_easter_monday(year_curt);
+        holidays.push_back(easter_monday);
+
+        // Labour Day
+        lib_date::myDate labour_day = lib_date::myDate(year_curt * 10000 + 5 * 100 + 1);
+        holidays.push_back(labour_day);
+
+        // Christmas Day
+        lib_date::myDate christmas_day = lib_date::myDate(year_curt * 10000 + 12 * 100 + 25);
+        holidays.push_back(christmas_day);
+
+        // Christmas Holiday
+        lib_date::myDate christmas_holiday = lib_date::myDate(year_curt * 10000 + 12 * 100 + 26);
+        holidays.push_back(christmas_holiday);
+
+        // next year
+        year_curt++;
+    }
+
+    // return vector of closing days
+    return holidays;
+
+}
+
 // US federal public holidays
 std::vector<lib_date::myDate> lib_date::get_holidays_us(const std::size_t& year_begin, const std::size_t& year_end)
 {
@@ -432,6 +432,15 @@ namespace lib_date
      */
     std::vector<myDate> get_holidays_de(const std::size_t& year_begin, const std::size_t& year_end);
 
+    /**
+     * @brief Get TARGET2 closing days (euro area money market calendar) for a certain time period specified through beging and end year.
+     * 
+     * @param year_begin Begining year.
+     * @param year_end End year.
+     * @return std::vector<myDate> Vector of closing days dates.
+     */
+    std::vector<myDate> get_holidays_eu(const std::size_t& year_begin, const std::size_t& year_end);
+
     /**
      * @brief Get US holidays for a certain time period specified through beging and end year.
      * 
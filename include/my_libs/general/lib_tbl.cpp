@@ -532,14 +532,21 @@ namespace lib_tbl
         // check that the file is indeed opened
         if (f.is_open())
         {
-            // read columns names
+            // read columns names; drop UTF-8 byte order mark if present
             getline(f, row);
+            if (row.compare(0, 3, "\xEF\xBB\xBF") == 0)
+                row = row.substr(3);
+            if (!row.empty() && (row.back() == '\r'))
+                row.pop_back();
             cells = cut_row_into_cells(row, sep, quotes);
             this->tbl.col_nms = *cells;
 
             // read the values
             while (getline(f, row))
             {
+                // drop carriage return of files with Windows line endings
+                if (!row.empty() && (row.back() == '\r'))
+                    row.pop_back();
                 cells = cut_row_into_cells(row, sep, quotes);
                 this->tbl.values.push_back(*cells);
             }
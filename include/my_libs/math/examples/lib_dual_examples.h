@@ -0,0 +1,21 @@
+#include <iostream>
+#include <string>
+#include "lib_dual.h"
+
+int main()
+{
+    // DERIVATIVES OF A FUNCTION OF TWO VARIABLES
+    {
+        std::cout << "DERIVATIVES OF A FUNCTION OF TWO VARIABLES" << std::endl;
+
+        // f(x, y) = exp(x * y) / y evaluated at (1.0, 2.0); both partial derivatives are carried in one pass
+        lib_math::dual<2> x = lib_math::dual<2>::seed(1.0, 0);
+        lib_math::dual<2> y = lib_math::dual<2>::seed(2.0, 1);
+        lib_math::dual<2> f = exp(x * y) / y;
+        std::cout << "f(1.0, 2.0) = " << std::to_string(f.val) << ", df/dx = " << std::to_string(f.grad[0]) << ", df/dy = " << std::to_string(f.grad[1]);
+        std::cout << '\n' << std::endl;
+    }
+
+    // everything OK
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include <vector>
 #include "lib_math.h"
 #include "lib_mtrx.h"
 
@@ -316,6 +317,29 @@ int lib_mtrx_examples()
         std::cout << '\n' << std::endl;
     }
 
+    // eigenvalues and eigenvectors of symmetric matrix
+    {
+        std::cout << "EIGENVALUES AND EIGENVECTORS OF SYMMETRIC MATRIX" << std::endl;
+
+        // create symmetric matrix
+        std::vector<std::vector<double>> mtrx_elements =
+            {{4, 1, 2},
+             {1, 3, 0},
+             {2, 0, 5}};
+        std::shared_ptr<lib_mtrx::myMatrix2D> mtrx = std::make_shared<lib_mtrx::myMatrix2D>(mtrx_elements);
+        mtrx->print();
+
+        // eigenvalues in descending order and eigenvectors in columns
+        auto [eig_vals, eig_vecs] = lib_mtrx::sym_eig(mtrx);
+        std::cout << "eigenvalues" << std::endl;
+        for (double eig_val : eig_vals)
+            std::cout << eig_val << std::endl;
+        std::cout << "eigenvectors" << std::endl;
+        eig_vecs->print();
+
+        std::cout << '\n' << std::endl;
+    }
+
     // store matrix into a .csv file
     {
         std::cout << "STORE MATRIX INTO .CSV FILE" << std::endl;
@@ -0,0 +1,24 @@
+#include <iostream>
+#include <string>
+#include "lib_tape.h"
+
+int main()
+{
+    // GRADIENT OF A FUNCTION OF TWO VARIABLES
+    {
+        std::cout << "GRADIENT OF A FUNCTION OF TWO VARIABLES" << std::endl;
+
+        // f(x, y) = exp(x * y) / y evaluated at (1.0, 2.0); both partial derivatives are obtained by a single backward sweep
+        lib_math::myTape tape;
+        lib_math::adjoint x = lib_math::adjoint::input(tape, 1.0);
+        lib_math::adjoint y = lib_math::adjoint::input(tape, 2.0);
+        lib_math::adjoint f = exp(x * y) / y;
+        tape.add_adj(f.pos, 1.0);
+        tape.sweep();
+        std::cout << "f(1.0, 2.0) = " << std::to_string(f.val) << ", df/dx = " << std::to_string(tape.get_adj(x.pos)) << ", df/dy = " << std::to_string(tape.get_adj(y.pos));
+        std::cout << '\n' << std::endl;
+    }
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,179 @@
+/** \example lib_dual_examples.h
+ * @file lib_dual.h
+ * @author Michal Mackanic
+ * @brief Dual numbers for forward-mode automatic differentiation with respect to several input variables at once.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <array>
+#include <cstddef>
+
+namespace lib_math
+{
+    /**
+     * @brief Dual number holding a value together with its gradient with respect to N input variables. Gradient lanes are stored contiguously and aligned, so
+     * that loops over the lanes of fixed width could be vectorized; the width should be a multiple of the SIMD register width, e.g. 4 or 8.
+     *
+     * @tparam N Number of gradient lanes.
+     */
+    template<std::size_t N>
+    struct dual
+    {
+        double val = 0.0;
+        alignas(32) std::array<double, N> grad = {};
+
+        dual() = default;
+        dual(const double& val) : val(val) {};
+
+        /**
+         * @brief Seed an input variable, i.e. its gradient is one in its own lane and zero in the other lanes.
+         *
+         * @param val Value of the input variable.
+         * @param lane Gradient lane of the input variable.
+         * @return dual<N> Input variable.
+         */
+        static dual<N> seed(const double& val, const std::size_t& lane)
+        {
+            dual<N> x(val);
+            x.grad[lane] = 1.0;
+            return x;
+        }
+
+        dual<N>& operator+=(const dual<N>& y) {this->val += y.val; for (std::size_t i = 0; i < N; i++) this->grad[i] += y.grad[i]; return *this;};
+        dual<N>& operator-=(const dual<N>& y) {this->val -= y.val; for (std::size_t i = 0; i < N; i++) this->grad[i] -= y.grad[i]; return *this;};
+        dual<N>& operator*=(const dual<N>& y) {*this = *this * y; return *this;};
+        dual<N>& operator/=(const dual<N>& y) {*this = *this / y; return *this;};
+    };
+
+    /**
+     * @brief Apply a function to a dual number given the function value and its derivative at the value of the dual number, i.e. chain rule.
+     *
+     * @tparam N Number of gradient lanes.
+     * @param x Dual number.
+     * @param f_val Function value.
+     * @param f_deriv Derivative of the function.
+     * @return dual<N> Function value together with its gradient.
+     */
+    template<std::size_t N>
+    dual<N> chain(const dual<N>& x, const double& f_val, const double& f_deriv)
+    {
+        dual<N> z(f_val);
+        for (std::size_t i = 0; i < N; i++)
+            z.grad[i] = f_deriv * x.grad[i];
+        return z;
+    }
+
+    template<std::size_t N>
+    dual<N> operator-(const dual<N>& x)
+    {
+        return lib_math::chain(x, -x.val, -1.0);
+    }
+
+    template<std::size_t N>
+    dual<N> operator+(const dual<N>& x, const dual<N>& y)
+    {
+        dual<N> z = x;
+        z += y;
+        return z;
+    }
+
+    template<std::size_t N>
+    dual<N> operator-(const dual<N>& x, const dual<N>& y)
+    {
+        dual<N> z = x;
+        z -= y;
+        return z;
+    }
+
+    template<std::size_t N>
+    dual<N> operator*(const dual<N>& x, const dual<N>& y)
+    {
+        dual<N> z(x.val * y.val);
+        for (std::size_t i = 0; i < N; i++)
+            z.grad[i] = x.grad[i] * y.val + x.val * y.grad[i];
+        return z;
+    }
+
+    template<std::size_t N>
+    dual<N> operator/(const dual<N>& x, const dual<N>& y)
+    {
+        dual<N> z(x.val / y.val);
+        for (std::size_t i = 0; i < N; i++)
+            z.grad[i] = (x.grad[i] - z.val * y.grad[i]) / y.val;
+        return z;
+    }
+
+    // operations with a constant do not need to evaluate gradient of the constant
+    template<std::size_t N>
+    dual<N> operator+(const dual<N>& x, const double& y) {return lib_math::chain(x, x.val + y, 1.0);}
+
+    template<std::size_t N>
+    dual<N> operator+(const double& x, const dual<N>& y) {return lib_math::chain(y, x + y.val, 1.0);}
+
+    template<std::size_t N>
+    dual<N> operator-(const dual<N>& x, const double& y) {return lib_math::chain(x, x.val - y, 1.0);}
+
+    template<std::size_t N>
+    dual<N> operator-(const double& x, const dual<N>& y) {return lib_math::chain(y, x - y.val, -1.0);}
+
+    template<std::size_t N>
+    dual<N> operator*(const dual<N>& x, const double& y) {return lib_math::chain(x, x.val * y, y);}
+
+    template<std::size_t N>
+    dual<N> operator*(const double& x, const dual<N>& y) {return lib_math::chain(y, x * y.val, x);}
+
+    template<std::size_t N>
+    dual<N> operator/(const dual<N>& x, const double& y) {return lib_math::chain(x, x.val / y, 1.0 / y);}
+
+    template<std::size_t N>
+    dual<N> operator/(const double& x, const dual<N>& y)
+    {
+        double z_val = x / y.val;
+        return lib_math::chain(y, z_val, -z_val / y.val);
+    }
+
+    // elementary functions are found through argument dependent lookup, so that templated code could call them unqualified
+    template<std::size_t N>
+    dual<N> exp(const dual<N>& x)
+    {
+        double f_val = std::exp(x.val);
+        return lib_math::chain(x, f_val, f_val);
+    }
+
+    template<std::size_t N>
+    dual<N> log(const dual<N>& x)
+    {
+        return lib_math::chain(x, std::log(x.val), 1.0 / x.val);
+    }
+
+    template<std::size_t N>
+    dual<N> pow(const dual<N>& x, const double& y)
+    {
+        double f_val = std::pow(x.val, y);
+        return lib_math::chain(x, f_val, y * f_val / x.val);
+    }
+
+    template<std::size_t N>
+    dual<N> abs(const dual<N>& x)
+    {
+        return (x.val < 0.0) ? -x : x;
+    }
+
+    /**
+     * @brief Get value of a scalar, i.e. the number itself or value of a dual number, so that templated code could branch on values of its scalars.
+     *
+     * @param x Scalar.
+     * @return double Value.
+     */
+    inline double get_val(const double& x) {return x;}
+
+    template<std::size_t N>
+    double get_val(const dual<N>& x) {return x.val;}
+}
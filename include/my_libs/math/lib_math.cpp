@@ -105,6 +105,89 @@ std::vector<double> lib_math::lin_interp1d(const std::vector<double>& x, const s
     return Y;
 }
 
+std::vector<double> lib_math::cubic_spline_derivs(const std::vector<double>& x, const std::vector<double>& y)
+{
+    // checks
+    if (x.size() < 2)
+        throw std::runtime_error((std::string)__func__ + ": Cubic spline requires at least two points!");
+
+    if (x.size() != y.size())
+        throw std::runtime_error((std::string)__func__ + ": Length of x and y vectors must be the same!");
+
+    // second derivatives at the end points are zero
+    std::size_t n = x.size();
+    std::vector<double> derivs(n, 0.0);
+    if (n == 2)
+        return derivs;
+
+    // forward sweep of Thomas algorithm; equation of inner point i reads
+    // h[i - 1] * M[i - 1] + 2 * (h[i - 1] + h[i]) * M[i] + h[i] * M[i + 1] = 6 * ((y[i + 1] - y[i]) / h[i] - (y[i] - y[i - 1]) / h[i - 1])
+    std::vector<double> c_aux(n, 0.0);
+    std::vector<double> d_aux(n, 0.0);
+    for (std::size_t i = 1; i < n - 1; i++)
+    {
+        double h_low = x[i] - x[i - 1];
+        double h_high = x[i + 1] - x[i];
+        double rhs = 6.0 * ((y[i + 1] - y[i]) / h_high - (y[i] - y[i - 1]) / h_low);
+        double denom = 2.0 * (h_low + h_high) - h_low * c_aux[i - 1];
+        c_aux[i] = h_high / denom;
+        d_aux[i] = (rhs - h_low * d_aux[i - 1]) / denom;
+    }
+
+    // back substitution
+    for (std::size_t i = n - 2; i > 0; i--)
+        derivs[i] = d_aux[i] - c_aux[i] * derivs[i + 1];
+
+    // return second derivatives
+    return derivs;
+}
+
+std::vector<double> lib_math::cubic_interp1d(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& X, const bool extrapolate)
+{
+    // checks
+    if (X.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Vector X must contain at least one point!");
+
+    // second derivatives at individual x points
+    std::vector<double> derivs = cubic_spline_derivs(x, y);
+    std::size_t n = x.size();
+
+    // vector holding interpolated points Y
+    std::vector<double> Y;
+
+    // go through points X
+    for (std::size_t X_idx = 0; X_idx < X.size(); X_idx++)
+    {
+        // lower values
+        if (X[X_idx] <= x[0])
+        {
+            double h = x[1] - x[0];
+            double slope = (y[1] - y[0]) / h - h * (2.0 * derivs[0] + derivs[1]) / 6.0;
+            Y.push_back(extrapolate ? y[0] - slope * (x[0] - X[X_idx]) : y[0]);
+        }
+        // upper values
+        else if (X[X_idx] >= x[n - 1])
+        {
+            double h = x[n - 1] - x[n - 2];
+            double slope = (y[n - 1] - y[n - 2]) / h + h * (derivs[n - 2] + 2.0 * derivs[n - 1]) / 6.0;
+            Y.push_back(extrapolate ? y[n - 1] + slope * (X[X_idx] - x[n - 1]) : y[n - 1]);
+        }
+        // intermediate points
+        else
+        {
+            std::size_t i = std::upper_bound(x.begin(), x.end(), X[X_idx]) - x.begin() - 1;
+            double h = x[i + 1] - x[i];
+            double a = (x[i + 1] - X[X_idx]) / h;
+            double b = (X[X_idx] - x[i]) / h;
+            double Y_aux = a * y[i] + b * y[i + 1] + ((a * a * a - a) * derivs[i] + (b * b * b - b) * derivs[i + 1]) * h * h / 6.0;
+            Y.push_back(Y_aux);
+        }
+    }
+
+    // return interpolated values
+    return Y;
+}
+
 /*
  * NORMAL DISTRIBUTION
  */
@@ -38,6 +38,27 @@ namespace lib_math
      */
     std::vector<double> lin_interp1d(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& X, const bool extrapolate = false);
 
+    /**
+     * @brief Second derivatives of natural cubic spline at its knots, i.e. second derivatives at the end points are zero. Tridiagonal system of equations
+     * is solved in O(n).
+     * 
+     * @param x Vector of x points ordered from lower to higher.
+     * @param y Vector of y points corresponding to individual x points.
+     * @return std::vector<double> Vector of second derivatives at individual x points.
+     */
+    std::vector<double> cubic_spline_derivs(const std::vector<double>& x, const std::vector<double>& y);
+
+    /**
+     * @brief Natural cubic spline 1D interpolation.
+     * 
+     * @param x Vector of x points ordered from lower to higher.
+     * @param y Vector of y points corresponding to individual x points.
+     * @param X Vector of X points for which Y points should be interpolated based on x and y points.
+     * @param extrapolate true => Extrapolate end points linearly using slope of the spline at the end points. \n false => Do not extrapolate end points.
+     * @return std::vector<double> Vector of interpolated points Y.
+     */
+    std::vector<double> cubic_interp1d(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& X, const bool extrapolate = false);
+
     /** 
      * @brief Standardized normal CDF evaluated at a single point.
      * 
@@ -4,6 +4,11 @@
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <vector>
+#include <tuple>
+#include <cmath>
+#include <numeric>
+#include <algorithm>
 #include "lib_mtrx.h"
 #include "lib_str.h"
 #include "lib_math.h"
@@ -683,4 +688,113 @@ std::shared_ptr<lib_mtrx::myMatrix2D> lib_mtrx::mult_mtrx(const std::vector<std:
 
     // return the resulting matrix
     return mtrx_;  
-}
\ No newline at end of file
+}
+
+// eigenvalues and eigenvectors of symmetric matrix
+std::tuple<std::vector<double>, std::shared_ptr<lib_mtrx::myMatrix2D>> lib_mtrx::sym_eig(const std::shared_ptr<lib_mtrx::myMatrix2D> mtrx, const double& tol, const unsigned short& sweeps_max)
+{
+    // check that the matrix is square and symmetric
+    std::size_t n = mtrx->get_x();
+    if (n != mtrx->get_y())
+        throw std::runtime_error((std::string)__func__ + ": Matrix is not square!");
+
+    double norm = 0.0;
+    for (std::size_t x = 0; x < n; x++)
+    {
+        for (std::size_t y = 0; y < n; y++)
+            norm += mtrx->elements[x][y] * mtrx->elements[x][y];
+    }
+    norm = std::sqrt(norm);
+    for (std::size_t x = 0; x < n; x++)
+    {
+        for (std::size_t y = x + 1; y < n; y++)
+        {
+            if (std::abs(mtrx->elements[x][y] - mtrx->elements[y][x]) > 1e-12 * std::max(norm, 1.0))
+                throw std::runtime_error((std::string)__func__ + ": Matrix is not symmetric!");
+        }
+    }
+
+    // rotations are applied to a copy of the matrix; eigenvectors accumulate rotations starting from unit matrix
+    std::vector<std::vector<double>> a = mtrx->elements;
+    std::vector<std::vector<double>> v(n, std::vector<double>(n, 0.0));
+    for (std::size_t x = 0; x < n; x++)
+        v[x][x] = 1.0;
+
+    // each sweep annihilates all off-diagonal elements in turn; convergence is quadratic once the elements are small
+    bool converged = (n < 2);
+    for (unsigned short sweep = 0; (sweep < sweeps_max) && !converged; sweep++)
+    {
+        double off = 0.0;
+        for (std::size_t p = 0; p < n; p++)
+        {
+            for (std::size_t q = p + 1; q < n; q++)
+                off += 2.0 * a[p][q] * a[p][q];
+        }
+        if (std::sqrt(off) <= tol * norm)
+        {
+            converged = true;
+            break;
+        }
+
+        for (std::size_t p = 0; p < n - 1; p++)
+        {
+            for (std::size_t q = p + 1; q < n; q++)
+            {
+                if (a[p][q] == 0.0)
+                    continue;
+
+                // rotation angle is chosen so that the element [p][q] becomes zero; the smaller of the two roots keeps the rotation stable
+                double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                double t = ((theta >= 0.0) ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                double c = 1.0 / std::sqrt(t * t + 1.0);
+                double s = t * c;
+
+                // rotate columns p and q, then rows p and q
+                for (std::size_t k = 0; k < n; k++)
+                {
+                    double a_kp = a[k][p];
+                    double a_kq = a[k][q];
+                    a[k][p] = c * a_kp - s * a_kq;
+                    a[k][q] = s * a_kp + c * a_kq;
+                }
+                for (std::size_t k = 0; k < n; k++)
+                {
+                    double a_pk = a[p][k];
+                    double a_qk = a[q][k];
+                    a[p][k] = c * a_pk - s * a_qk;
+                    a[q][k] = s * a_pk + c * a_qk;
+                }
+                a[p][q] = 0.0;
+                a[q][p] = 0.0;
+
+                // accumulate the rotation into eigenvectors
+                for (std::size_t k = 0; k < n; k++)
+                {
+                    double v_kp = v[k][p];
+                    double v_kq = v[k][q];
+                    v[k][p] = c * v_kp - s * v_kq;
+                    v[k][q] = s * v_kp + c * v_kq;
+                }
+            }
+        }
+    }
+    if (!converged)
+        throw std::runtime_error((std::string)__func__ + ": Jacobi rotations did not converge in " + std::to_string(sweeps_max) + " sweeps!");
+
+    // sort eigenvalues in descending order together with their eigenvectors
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const std::size_t& idx1, const std::size_t& idx2) {return a[idx1][idx1] > a[idx2][idx2];});
+
+    std::vector<double> eig_vals(n);
+    std::shared_ptr<lib_mtrx::myMatrix2D> eig_vecs = std::make_shared<lib_mtrx::myMatrix2D>(n, n, 0.0, false);
+    for (std::size_t y = 0; y < n; y++)
+    {
+        eig_vals[y] = a[order[y]][order[y]];
+        for (std::size_t x = 0; x < n; x++)
+            eig_vecs->elements[x][y] = v[x][order[y]];
+    }
+
+    // return eigenvalues and eigenvectors
+    return {eig_vals, eig_vecs};
+}
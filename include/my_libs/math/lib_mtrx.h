@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <tuple>
 
 namespace lib_mtrx
 {
@@ -238,4 +239,15 @@ namespace lib_mtrx
      * @return std::shared_ptr<myMatrix2D> Resulting matrix.
      */
     std::shared_ptr<myMatrix2D> mult_mtrx(const std::vector<std::shared_ptr<myMatrix2D>> mtrxs);
+
+    /**
+     * @brief Eigenvalues and eigenvectors of a symmetric matrix using cyclic Jacobi rotations.
+     * 
+     * @param mtrx Symmetric matrix.
+     * @param tol Relative tolerance; rotations stop once the off-diagonal norm falls below tol times the matrix norm.
+     * @param sweeps_max Maximum number of sweeps over all off-diagonal elements.
+     * @return std::tuple<std::vector<double>, std::shared_ptr<myMatrix2D>> Eigenvalues sorted in descending order and matrix with the corresponding
+     * eigenvectors of unit length in its columns.
+     */
+    std::tuple<std::vector<double>, std::shared_ptr<myMatrix2D>> sym_eig(const std::shared_ptr<myMatrix2D> mtrx, const double& tol = 1e-14, const unsigned short& sweeps_max = 100);
 }
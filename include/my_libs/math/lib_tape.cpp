@@ -0,0 +1,47 @@
+#include <vector>
+#include <algorithm>
+#include "lib_tape.h"
+
+// discard operations recorded after a position
+void lib_math::myTape::rewind(const std::size_t& size)
+{
+    if (size < this->size)
+        this->size = size;
+    if (size < this->adjs.size())
+        this->adjs.resize(size);
+}
+
+// set adjoints to zero
+void lib_math::myTape::clear_adjs()
+{
+    std::fill(this->adjs.begin(), this->adjs.end(), 0.0);
+}
+
+// add to adjoint of an operation
+void lib_math::myTape::add_adj(const std::size_t& pos, const double& adj)
+{
+    if (this->adjs.size() < this->size)
+        this->adjs.resize(this->size, 0.0);
+    this->adjs[pos] += adj;
+}
+
+// propagate adjoints backwards
+void lib_math::myTape::sweep(const std::size_t& pos_start)
+{
+    if (this->adjs.size() < this->size)
+        this->adjs.resize(this->size, 0.0);
+
+    // operations with zero adjoint do not contribute
+    for (std::size_t pos = this->size; pos > pos_start; pos--)
+    {
+        double adj = this->adjs[pos - 1];
+        if (adj == 0.0)
+            continue;
+
+        const lib_math::tape_node& node = this->blocks[(pos - 1) >> block_bits][(pos - 1) & (block_size - 1)];
+        if (node.args[0] != lib_math::myTape::npos)
+            this->adjs[node.args[0]] += node.derivs[0] * adj;
+        if (node.args[1] != lib_math::myTape::npos)
+            this->adjs[node.args[1]] += node.derivs[1] * adj;
+    }
+}
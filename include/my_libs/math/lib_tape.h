@@ -0,0 +1,234 @@
+/** \example lib_tape_examples.h
+ * @file lib_tape.h
+ * @author Michal Mackanic
+ * @brief Tape for reverse-mode (adjoint) automatic differentiation, i.e. gradient of a single output with respect to any number of inputs in one backward sweep.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <limits>
+
+namespace lib_math
+{
+    /**
+     * @brief Operation recorded on tape; each operation has at most two arguments together with partial derivatives of the operation with respect to them.
+     *
+     */
+    struct tape_node
+    {
+        std::size_t args[2];
+        double derivs[2];
+    };
+
+    /**
+     * @brief Tape recording operations with adjoint variables. Operations are stored in an arena of fixed-size blocks, i.e. recorded operations are never
+     * moved when the tape grows, and the blocks are kept when the tape is rewound, so that the same tape can be re-recorded many times without new
+     * allocations, e.g. once per checkpoint.
+     *
+     */
+    class myTape
+    {
+        private:
+            static constexpr std::size_t block_bits = 16;
+            static constexpr std::size_t block_size = std::size_t(1) << block_bits;
+            std::vector<std::unique_ptr<lib_math::tape_node[]>> blocks;
+            std::size_t size = 0;
+            std::vector<double> adjs;
+
+        public:
+            // position of a constant, i.e. variable which is not recorded on tape
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            /**
+             * @brief Construct a new myTape object.
+             *
+             * @param capacity Number of operations the arena is allocated for upfront; the arena grows by blocks if needed.
+             */
+            myTape(const std::size_t& capacity = block_size)
+            {
+                while (this->blocks.size() * block_size < capacity)
+                    this->blocks.push_back(std::unique_ptr<lib_math::tape_node[]>(new lib_math::tape_node[block_size]));
+            };
+
+            /**
+             * @brief Record operation.
+             *
+             * @param arg1 Position of the first argument.
+             * @param deriv1 Partial derivative with respect to the first argument.
+             * @param arg2 Position of the second argument; npos if the operation has a single argument.
+             * @param deriv2 Partial derivative with respect to the second argument.
+             * @return std::size_t Position of the operation.
+             */
+            std::size_t push(const std::size_t& arg1, const double& deriv1, const std::size_t& arg2 = npos, const double& deriv2 = 0.0)
+            {
+                if ((this->size >> block_bits) == this->blocks.size())
+                    this->blocks.push_back(std::unique_ptr<lib_math::tape_node[]>(new lib_math::tape_node[block_size]));
+                this->blocks[this->size >> block_bits][this->size & (block_size - 1)] = {{arg1, arg2}, {deriv1, deriv2}};
+                return this->size++;
+            };
+
+            /**
+             * @brief Get number of recorded operations.
+             *
+             * @return std::size_t Number of recorded operations.
+             */
+            std::size_t get_size() const {return this->size;};
+
+            /**
+             * @brief Rewind tape, i.e. discard operations recorded after a position together with their adjoints; allocated memory is kept.
+             *
+             * @param size Number of operations to be kept.
+             */
+            void rewind(const std::size_t& size);
+
+            /**
+             * @brief Set adjoints of all recorded operations to zero.
+             *
+             */
+            void clear_adjs();
+
+            /**
+             * @brief Add to adjoint of a recorded operation, e.g. seed output of a backward sweep.
+             *
+             * @param pos Position of the operation.
+             * @param adj Adjoint to be added.
+             */
+            void add_adj(const std::size_t& pos, const double& adj);
+
+            /**
+             * @brief Get adjoint of a recorded operation.
+             *
+             * @param pos Position of the operation.
+             * @return double Adjoint; zero if the sweep has not reached the operation.
+             */
+            double get_adj(const std::size_t& pos) const {return (pos < this->adjs.size()) ? this->adjs[pos] : 0.0;};
+
+            /**
+             * @brief Propagate adjoints backwards from the last recorded operation. Adjoints of operations recorded before the start position are accumulated
+             * but not propagated further, so that a segment of tape could be swept on its own.
+             *
+             * @param pos_start Position of the first operation of the swept segment.
+             */
+            void sweep(const std::size_t& pos_start = 0);
+    };
+
+    /**
+     * @brief Variable recorded on tape. Variables constructed from a number are constants which are not recorded.
+     *
+     */
+    struct adjoint
+    {
+        double val = 0.0;
+        std::size_t pos = lib_math::myTape::npos;
+        lib_math::myTape* tape = nullptr;
+
+        adjoint() = default;
+        adjoint(const double& val) : val(val) {};
+        adjoint(const double& val, const std::size_t& pos, lib_math::myTape* tape) : val(val), pos(pos), tape(tape) {};
+
+        /**
+         * @brief Create an input variable, i.e. variable recorded on tape without arguments.
+         *
+         * @param tape Tape.
+         * @param val Value of the input variable.
+         * @return adjoint Input variable.
+         */
+        static adjoint input(lib_math::myTape& tape, const double& val) {return adjoint(val, tape.push(lib_math::myTape::npos, 0.0), &tape);};
+
+        adjoint& operator+=(const adjoint& y);
+        adjoint& operator-=(const adjoint& y);
+        adjoint& operator*=(const adjoint& y);
+        adjoint& operator/=(const adjoint& y);
+    };
+
+    /**
+     * @brief Record result of an operation with a single argument; constant argument gives constant result.
+     *
+     * @param val Value of the result.
+     * @param x Argument.
+     * @param dx Partial derivative with respect to the argument.
+     * @return adjoint Result.
+     */
+    inline adjoint record(const double& val, const adjoint& x, const double& dx)
+    {
+        if (x.tape == nullptr)
+            return adjoint(val);
+        return adjoint(val, x.tape->push(x.pos, dx), x.tape);
+    }
+
+    /**
+     * @brief Record result of an operation with two arguments; constant arguments are not recorded.
+     *
+     * @param val Value of the result.
+     * @param x The first argument.
+     * @param dx Partial derivative with respect to the first argument.
+     * @param y The second argument.
+     * @param dy Partial derivative with respect to the second argument.
+     * @return adjoint Result.
+     */
+    inline adjoint record(const double& val, const adjoint& x, const double& dx, const adjoint& y, const double& dy)
+    {
+        if (x.tape == nullptr)
+            return lib_math::record(val, y, dy);
+        if (y.tape == nullptr)
+            return lib_math::record(val, x, dx);
+        return adjoint(val, x.tape->push(x.pos, dx, y.pos, dy), x.tape);
+    }
+
+    inline adjoint operator-(const adjoint& x) {return lib_math::record(-x.val, x, -1.0);}
+    inline adjoint operator+(const adjoint& x, const adjoint& y) {return lib_math::record(x.val + y.val, x, 1.0, y, 1.0);}
+    inline adjoint operator-(const adjoint& x, const adjoint& y) {return lib_math::record(x.val - y.val, x, 1.0, y, -1.0);}
+    inline adjoint operator*(const adjoint& x, const adjoint& y) {return lib_math::record(x.val * y.val, x, y.val, y, x.val);}
+
+    inline adjoint operator/(const adjoint& x, const adjoint& y)
+    {
+        double z_val = x.val / y.val;
+        return lib_math::record(z_val, x, 1.0 / y.val, y, -z_val / y.val);
+    }
+
+    // operations with a constant record a single argument
+    inline adjoint operator+(const adjoint& x, const double& y) {return lib_math::record(x.val + y, x, 1.0);}
+    inline adjoint operator+(const double& x, const adjoint& y) {return lib_math::record(x + y.val, y, 1.0);}
+    inline adjoint operator-(const adjoint& x, const double& y) {return lib_math::record(x.val - y, x, 1.0);}
+    inline adjoint operator-(const double& x, const adjoint& y) {return lib_math::record(x - y.val, y, -1.0);}
+    inline adjoint operator*(const adjoint& x, const double& y) {return lib_math::record(x.val * y, x, y);}
+    inline adjoint operator*(const double& x, const adjoint& y) {return lib_math::record(x * y.val, y, x);}
+    inline adjoint operator/(const adjoint& x, const double& y) {return lib_math::record(x.val / y, x, 1.0 / y);}
+
+    inline adjoint operator/(const double& x, const adjoint& y)
+    {
+        double z_val = x / y.val;
+        return lib_math::record(z_val, y, -z_val / y.val);
+    }
+
+    inline adjoint& adjoint::operator+=(const adjoint& y) {*this = *this + y; return *this;}
+    inline adjoint& adjoint::operator-=(const adjoint& y) {*this = *this - y; return *this;}
+    inline adjoint& adjoint::operator*=(const adjoint& y) {*this = *this * y; return *this;}
+    inline adjoint& adjoint::operator/=(const adjoint& y) {*this = *this / y; return *this;}
+
+    // elementary functions are found through argument dependent lookup, so that templated code could call them unqualified
+    inline adjoint exp(const adjoint& x)
+    {
+        double f_val = std::exp(x.val);
+        return lib_math::record(f_val, x, f_val);
+    }
+
+    inline adjoint log(const adjoint& x) {return lib_math::record(std::log(x.val), x, 1.0 / x.val);}
+
+    inline adjoint pow(const adjoint& x, const double& y)
+    {
+        double f_val = std::pow(x.val, y);
+        return lib_math::record(f_val, x, y * f_val / x.val);
+    }
+
+    inline adjoint abs(const adjoint& x) {return (x.val < 0.0) ? -x : x;}
+}
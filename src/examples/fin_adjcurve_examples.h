@@ -0,0 +1,124 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include "lib_aux.h"
+#include "lib_tape.h"
+#include "fin_zerorate.h"
+#include "fin_bootstrap.h"
+#include "fin_adjcurve.h"
+
+int main()
+{
+    std::cout << "ADJOINT SENSITIVITIES" << std::endl;
+
+    // bootstrap ESTER curve and 3M EURIBOR projection curve discounted by the ESTER curve
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date = "20220531";
+    std::cout << "Bootstrapping curves..." << std::endl;
+    fin_curves::myBootstrap bootstrap_dsc = fin_curves::myBootstrap(path, "eur_ri_ester");
+
+    // ESTER quotes are stored only for 20220429; they serve as proxy quotes as of 20220531, which is enough to compare adjoints with bump and revalue
+    bootstrap_dsc.load("20220429");
+    std::vector<std::string> tenors_dsc;
+    std::vector<std::string> generator_nms_dsc;
+    std::vector<std::shared_ptr<double>> quotes_dsc;
+    for (const fin_curves::pillar& pillar : bootstrap_dsc.get_pillars())
+    {
+        tenors_dsc.push_back(pillar.tenor);
+        generator_nms_dsc.push_back(pillar.generator);
+        quotes_dsc.push_back(std::make_shared<double>(*pillar.quote));
+    }
+    bootstrap_dsc.load(date, tenors_dsc, generator_nms_dsc, quotes_dsc);
+    bootstrap_dsc.run();
+    std::shared_ptr<fin_curves::myZeroRate> eur_ri_ester = bootstrap_dsc.get_crv();
+    fin_curves::myBootstrap bootstrap_prj = fin_curves::myBootstrap(path, "eur_ri_3m_fo");
+    bootstrap_prj.set_dsc_crv(eur_ri_ester);
+    bootstrap_prj.load(date);
+    bootstrap_prj.run();
+
+    // portfolio of 5000 payer and receiver swaps with quarterly coupons and maturities up to 30 years
+    std::size_t trades_no = 5000;
+    std::vector<double> rates;
+    std::vector<double> notionals;
+    std::vector<std::size_t> cpns_nos;
+    for (std::size_t idx = 0; idx < trades_no; idx++)
+    {
+        rates.push_back(0.01 + 0.00001 * (idx % 200));
+        notionals.push_back((idx % 2 == 0) ? -700000.0 : 1000000.0);
+        cpns_nos.push_back(4 + (idx * 7) % 116);
+    }
+
+    // the same valuation serves curves recorded on tape and plain zero rate curves
+    auto value = [&](const auto& crv_prj, const auto& crv_dsc)
+    {
+        decltype(crv_dsc.get_df(0.0)) pv = 0.0;
+        for (std::size_t idx = 0; idx < trades_no; idx++)
+        {
+            for (std::size_t cpn = 1; cpn <= cpns_nos[idx]; cpn++)
+            {
+                double yr_frac_start = 0.25 * (cpn - 1);
+                double yr_frac_end = 0.25 * cpn;
+                auto fwd = crv_prj.get_df(yr_frac_start) / crv_prj.get_df(yr_frac_end) - 1.0;
+                pv += notionals[idx] * (fwd - 0.25 * rates[idx]) * crv_dsc.get_df(yr_frac_end);
+            }
+        }
+        return pv;
+    };
+
+    // frozen curves are recorded on tape; valuation does not differ from valuation using doubles
+    std::cout << "Valuing portfolio on tape..." << std::endl;
+    lib_aux::tic();
+    lib_math::myTape tape(1 << 22);
+    fin_curves::myAdjointCurve crv_prj = fin_curves::myAdjointCurve(bootstrap_prj.get_crv()->freeze(), tape);
+    fin_curves::myAdjointCurve crv_dsc = fin_curves::myAdjointCurve(eur_ri_ester->freeze(), tape);
+    lib_math::adjoint pv = value(crv_prj, crv_dsc);
+    std::cout << "   portfolio value: " << std::to_string(pv.val) << ", " << std::to_string(tape.get_size()) << " operations recorded" << std::endl;
+
+    // a single backward sweep gives adjoints of all curve nodes; bootstrap of the projection curve carries them to its quotes and to discount factors of
+    // swaps discounted by the ESTER curve, which are added to adjoints of the ESTER nodes before the ESTER bootstrap carries them to its quotes
+    std::cout << "Sweeping tape backwards..." << std::endl;
+    tape.add_adj(pv.pos, 1.0);
+    tape.sweep();
+    std::vector<std::tuple<double, double>> dsc_dfs_adj;
+    std::vector<double> quotes_adj_prj = bootstrap_prj.get_quotes_adj(crv_prj.get_zrs_adj(), dsc_dfs_adj);
+    crv_dsc.add_dfs_adj(dsc_dfs_adj);
+    std::vector<double> quotes_adj_dsc = bootstrap_dsc.get_quotes_adj(crv_dsc.get_zrs_adj());
+    std::cout << "   value and gradient evaluated in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+
+    // print bucketed delta, i.e. value change per 1bp of each quote of both curves
+    std::vector<fin_curves::pillar> pillars_prj = bootstrap_prj.get_pillars();
+    std::vector<fin_curves::pillar> pillars_dsc = bootstrap_dsc.get_pillars();
+    std::cout << "Bucketed delta per 1bp:" << std::endl;
+    for (std::size_t idx = 0; idx < pillars_prj.size(); idx += 10)
+        std::cout << "   eur_ri_3m_fo " << pillars_prj[idx].tenor << " " << pillars_prj[idx].generator << ": " << std::to_string(quotes_adj_prj[idx] * 0.0001) << std::endl;
+    for (std::size_t idx = 0; idx < pillars_dsc.size(); idx += 10)
+        std::cout << "   eur_ri_ester " << pillars_dsc[idx].tenor << " " << pillars_dsc[idx].generator << ": " << std::to_string(quotes_adj_dsc[idx] * 0.0001) << std::endl;
+
+    // bumped ESTER quote moves the projection curve through discounting of its swaps, so both curves are bootstrapped again; central differences
+    // agree with the adjoints up to the second order terms
+    std::cout << "Bump and revalue:" << std::endl;
+    fin_curves::bootstrap_state state_dsc = bootstrap_dsc.get_state();
+    for (std::size_t idx = 20; idx < pillars_dsc.size(); idx += 10)
+    {
+        double quote = *pillars_dsc[idx].quote;
+        double pvs[2];
+        for (int side = 0; side < 2; side++)
+        {
+            bootstrap_dsc.update(idx, quote + ((side == 0) ? 0.0001 : -0.0001));
+            fin_curves::myBootstrap bootstrap_bump = fin_curves::myBootstrap(path, "eur_ri_3m_fo");
+            bootstrap_bump.set_dsc_crv(eur_ri_ester);
+            bootstrap_bump.load(date);
+            bootstrap_bump.run();
+            pvs[side] = value(*bootstrap_bump.get_crv(), *eur_ri_ester);
+            bootstrap_dsc.set_state(state_dsc);
+        }
+        std::cout << "   eur_ri_ester " << pillars_dsc[idx].tenor << " " << pillars_dsc[idx].generator << ": " << std::to_string((pvs[0] - pvs[1]) / 2.0);
+        std::cout << " (adjoint: " << std::to_string(quotes_adj_dsc[idx] * 0.0001) << ")" << std::endl;
+    }
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
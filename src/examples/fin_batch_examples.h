@@ -0,0 +1,43 @@
+#include <iostream>
+#include <thread>
+#include "lib_aux.h"
+#include "fin_batch.h"
+
+int main()
+{
+    std::cout << "HISTORICAL BOOTSTRAP" << std::endl;
+
+    // ESTER curve is bootstrapped for all quote files of the date range; 3M curve discounted by ESTER curve follows
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date_from = "20200101";
+    std::string date_to = "20221231";
+
+    fin_curves::myBatch batch_ester = fin_curves::myBatch(path, "eur_ri_ester");
+    fin_curves::myBatch batch_3m = fin_curves::myBatch(path, "eur_ri_3m_fo");
+    batch_3m.set_dsc_crv_nm("eur_ri_ester");
+    batch_ester.set_suffix("_pokus");
+    batch_3m.set_suffix("_pokus");
+
+    for (fin_curves::myBatch* batch : {&batch_ester, &batch_3m})
+    {
+        lib_aux::tic();
+        std::size_t dates_ok_no = batch->run(date_from, date_to);
+        double time = lib_aux::toc();
+        std::cout << "   " << std::to_string(dates_ok_no) << " out of " << std::to_string(batch->get_dates().size()) << " dates bootstrapped in " << std::to_string(time);
+        std::cout << " seconds using " << std::to_string(std::thread::hardware_concurrency()) << " threads" << std::endl;
+
+        // print failed dates
+        std::vector<std::string> dates = batch->get_dates();
+        std::vector<std::string> errs = batch->get_errs();
+        for (std::size_t idx = 0; idx < dates.size(); idx++)
+        {
+            if (errs[idx].size() > 0)
+                std::cout << "   " << dates[idx] << ": " << errs[idx] << std::endl;
+        }
+    }
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "lib_str.h"
+#include "fin_generators.h"
+#include "fin_fxcurve.h"
+#include "fin_fxswpinstr.h"
+#include "fin_bsswpinstr.h"
+
+int main()
+{
+    // create generators
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::vector<std::string> instrument_nms = {"STFX_FXD_USDEUR", "BS_USDEUR_STFX"};
+    fin_curves::myGenerators generators = fin_curves::myGenerators(instrument_nms, path);
+    std::shared_ptr<fin_curves::generator> generator_fxswp = generators.get("STFX_FXD_USDEUR");
+    std::shared_ptr<fin_curves::generator> generator_bsswp = generators.get("BS_USDEUR_STFX");
+
+    // FX curve holding spot rate, ESTER curve discounting EUR leg and projection curves bootstrapped beforehand
+    std::string date_exec = "20220531";
+    std::string date_format = "yyyymmdd";
+    std::shared_ptr<fin_curves::myFxCurve> fx_crv = std::make_shared<fin_curves::myFxCurve>(path, "eur_usd");
+    fx_crv->set_date(date_exec, date_format);
+    fx_crv->set_spot(1.0698);
+    std::shared_ptr<fin_curves::myZeroRate> oth_crv = std::make_shared<fin_curves::myZeroRate>(path, "eur_ri_ester");
+    oth_crv->load(date_exec, date_format);
+    std::shared_ptr<fin_curves::myZeroRate> dom_prj_crv = std::make_shared<fin_curves::myZeroRate>(path, "eur_ri_3m_fo");
+    dom_prj_crv->load(date_exec, date_format);
+    std::shared_ptr<fin_curves::myZeroRate> for_prj_crv = std::make_shared<fin_curves::myZeroRate>(path, "usd_ri_3m_fo");
+    for_prj_crv->load(date_exec, date_format);
+
+    // short end of synthetic USD curve is given by FX swaps
+    fin_curves::myZeroRate crv = fin_curves::myZeroRate(path, "usd_synth_ester");
+    crv.set_date(date_exec, date_format);
+    std::vector<std::string> tenors_fxswp = {"ON", "TN", "1M", "3M", "6M", "1Y", "18M"};
+    std::vector<double> fwd_pts = {0.00004148, 0.0000425, 0.001791, 0.00549, 0.011547, 0.024621, 0.03524};
+    for (std::size_t idx = 0; idx < tenors_fxswp.size(); idx++)
+    {
+        fin_curves::myFxSwpInstr fxswp = fin_curves::myFxSwpInstr(date_exec, tenors_fxswp[idx], fwd_pts[idx], generator_fxswp, *fx_crv, *oth_crv, crv, date_format);
+        fx_crv->add(fxswp.get_yr_frac_fx());
+        crv.add(fxswp.get_yr_frac_zr());
+    }
+
+    // solve strip of cross-currency basis swaps; spread is paid on EUR leg
+    std::vector<std::string> tenors_bsswp = {"2Y", "3Y", "5Y", "7Y", "10Y", "15Y", "20Y", "30Y"};
+    std::vector<double> spreads = {-0.0017625, -0.00185, -0.0018375, -0.0018375, -0.0018375, -0.0015, -0.0007625, 0.0008125};
+    fin_curves::myBsSwpInstr bsswp = fin_curves::myBsSwpInstr(date_exec, generator_bsswp, crv, dom_prj_crv, for_prj_crv, oth_crv, fx_crv, date_format);
+
+    std::cout << instrument_nms[1] << std::endl;
+    std::cout << lib_str::repeate_char("=", 56) << std::endl;
+    std::cout << "|tenor  " << "|year fraction" << "|spread    " << "|zr        " << "|fx        " << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 56) << std::endl;
+    for (std::size_t idx = 0; idx < tenors_bsswp.size(); idx++)
+    {
+        std::tuple<double, double> yr_frac_zr = bsswp.solve(tenors_bsswp[idx], spreads[idx], crv);
+        crv.add(yr_frac_zr);
+        fx_crv->add(bsswp.get_yr_frac_fx());
+
+        // print synthetic zero rate and implied FX forward
+        std::cout << "|" << lib_str::add_trailing_char(tenors_bsswp[idx], 7) << "|" << lib_str::add_trailing_char(std::to_string(std::get<0>(yr_frac_zr)), 13);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(spreads[idx]), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(yr_frac_zr)), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(bsswp.get_yr_frac_fx())), 10);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 56) << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <iostream>
+#include "lib_aux.h"
+#include "lib_str.h"
+#include "fin_bootstrap.h"
+
+int main()
+{
+    std::cout << "GLOBAL CALIBRATION" << std::endl;
+
+    // curve definition
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string crv_nm = "eur_ri_3m_fo";
+    std::string date = "20220531";
+    fin_curves::myBootstrap bootstrap = fin_curves::myBootstrap(path, crv_nm);
+
+    // swaps are discounted by ESTER curve bootstrapped beforehand
+    std::shared_ptr<fin_curves::myZeroRate> dsc_crv = std::make_shared<fin_curves::myZeroRate>(path, "eur_ri_ester");
+    dsc_crv->load(date);
+    bootstrap.set_dsc_crv(dsc_crv);
+
+    // load quotes
+    bootstrap.load(date);
+
+    // sequential bootstrap
+    lib_aux::tic();
+    bootstrap.run();
+    std::cout << "sequential bootstrap finished in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+    std::shared_ptr<fin_curves::myZeroRate> crv_seq = std::make_shared<fin_curves::myZeroRate>(*bootstrap.get_crv());
+
+    // sequential bootstrap ignores nodes following the solved one; instruments reaching beyond nodes of later pillars would leave residuals once all
+    // nodes are in place
+    std::cout << "   largest residual with all nodes in place: " << std::scientific << bootstrap.get_residual_max() << std::defaultfloat << std::endl;
+
+    // global calibration starting from another curve, i.e. sequential curve shifted by 50 bp and tilted by 2 bp per year as a proxy of the previous
+    // business day curve far enough from the solution to need several Newton steps
+    std::vector<double> yr_fracs_init = crv_seq->get_yr_fracs();
+    std::vector<double> zrs_init;
+    for (std::size_t idx = 0; idx < yr_fracs_init.size(); idx++)
+        zrs_init.push_back(crv_seq->get_zr(idx) + 0.005 + 0.0002 * yr_fracs_init[idx]);
+    std::shared_ptr<fin_curves::myZeroRate> crv_init = std::make_shared<fin_curves::myZeroRate>(path, crv_nm);
+    crv_init->load(date, yr_fracs_init, zrs_init);
+    lib_aux::tic();
+    bootstrap.run_global(crv_init);
+    std::cout << "global calibration finished in " << std::to_string(lib_aux::toc()) << " seconds after " << std::to_string(bootstrap.get_calib_iters_no()) << " iterations" << std::endl;
+    std::cout << "   largest residual: " << std::scientific << bootstrap.get_residual_max() << std::defaultfloat << std::endl;
+
+    // compare zero rates
+    std::vector<fin_curves::pillar> pillars = bootstrap.get_pillars();
+    std::shared_ptr<fin_curves::myZeroRate> crv = bootstrap.get_crv();
+    std::cout << crv_nm << std::endl;
+    std::cout << lib_str::repeate_char("=", 57) << std::endl;
+    std::cout << "|tenor  " << "|generator           " << "|sequential" << "|global    " << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 57) << std::endl;
+    for (std::size_t idx = 0; idx < pillars.size(); idx++)
+    {
+        std::cout << "|" << lib_str::add_trailing_char(pillars[idx].tenor, 7) << "|" << lib_str::add_trailing_char(pillars[idx].generator, 20);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(crv_seq->get_zr(idx)), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(crv->get_zr(idx)), 10);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 57) << std::endl;
+
+    // SOFR curve under cubic spline; spline moves zero rates of all nodes, so run() calibrates them at once after the sequential bootstrap
+    std::string crv_nm_sofr = "usd_ri_sofr";
+    fin_curves::myBootstrap bootstrap_sofr = fin_curves::myBootstrap(path, crv_nm_sofr);
+    bootstrap_sofr.load(date);
+    bootstrap_sofr.run();
+    std::shared_ptr<fin_curves::myZeroRate> crv_sofr = bootstrap_sofr.get_crv();
+
+    fin_curves::zr_interp_def interp_def = crv_sofr->get_def();
+    interp_def.zr_interp = "cubic";
+    fin_curves::myBootstrap bootstrap_cubic = fin_curves::myBootstrap(path, crv_nm_sofr, interp_def);
+    bootstrap_cubic.load(date);
+    lib_aux::tic();
+    bootstrap_cubic.run();
+    std::cout << crv_nm_sofr << " cubic spline calibration finished in " << std::to_string(lib_aux::toc()) << " seconds after " << std::to_string(bootstrap_cubic.get_calib_iters_no()) << " iterations" << std::endl;
+    std::cout << "   largest residual: " << std::scientific << bootstrap_cubic.get_residual_max() << std::defaultfloat << std::endl;
+
+    // spline segment of each instrument moves with all nodes, i.e. instruments overlap; calibration is warm started from the linearly interpolated curve
+    lib_aux::tic();
+    bootstrap_cubic.run_global(crv_sofr);
+    std::cout << crv_nm_sofr << " cubic spline calibration from " << crv_sofr->get_def().zr_interp << " curve finished in " << std::to_string(lib_aux::toc()) << " seconds after " << std::to_string(bootstrap_cubic.get_calib_iters_no()) << " iterations" << std::endl;
+    std::cout << "   largest residual: " << std::scientific << bootstrap_cubic.get_residual_max() << std::defaultfloat << std::endl;
+    std::shared_ptr<fin_curves::myZeroRate> crv_cubic = bootstrap_cubic.get_crv();
+    for (double yr_frac : {0.75, 2.5, 7.5, 15.0})
+    {
+        std::cout << "   year fraction: " << std::to_string(yr_frac) << " - " << crv_sofr->get_def().zr_interp << ": " << std::to_string(crv_sofr->get_zr(yr_frac));
+        std::cout << ", cubic: " << std::to_string(crv_cubic->get_zr(yr_frac)) << std::endl;
+    }
+
+    // SOFR curve interpolated through discount factors; shipped definition stays linear, so the interpolation is set explicitly. Log-linear curve is
+    // still bootstrapped node by node, monotone convex interpolation moves neighbouring segments, so its nodes are calibrated at once
+    for (std::string zr_interp : {"log_linear", "monotone_convex"})
+    {
+        interp_def.zr_interp = zr_interp;
+        fin_curves::myBootstrap bootstrap_df = fin_curves::myBootstrap(path, crv_nm_sofr, interp_def);
+        bootstrap_df.load(date);
+        lib_aux::tic();
+        bootstrap_df.run();
+        std::cout << crv_nm_sofr << " " << zr_interp << " bootstrap finished in " << std::to_string(lib_aux::toc()) << " seconds";
+        if (bootstrap_df.get_calib_iters_no() > 0)
+            std::cout << " after " << std::to_string(bootstrap_df.get_calib_iters_no()) << " iterations";
+        std::cout << std::endl;
+        std::cout << "   largest residual: " << std::scientific << bootstrap_df.get_residual_max() << std::defaultfloat << std::endl;
+        std::shared_ptr<fin_curves::myZeroRate> crv_df = bootstrap_df.get_crv();
+        for (double yr_frac : {0.75, 2.5, 7.5, 15.0})
+        {
+            std::cout << "   year fraction: " << std::to_string(yr_frac) << " - " << crv_sofr->get_def().zr_interp << ": " << std::to_string(crv_sofr->get_zr(yr_frac));
+            std::cout << ", " << zr_interp << ": " << std::to_string(crv_df->get_zr(yr_frac)) << std::endl;
+        }
+    }
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <iostream>
+#include <vector>
+#include "lib_aux.h"
+#include "fin_zerorate.h"
+#include "fin_compcurve.h"
+
+int main()
+{
+    std::cout << "COMPOSITE CURVES" << std::endl;
+
+    // base curves are loaded and frozen only once
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date = "20220531";
+    fin_curves::myZeroRate eur_ri_3m_fo = fin_curves::myZeroRate(path, "eur_ri_3m_fo");
+    eur_ri_3m_fo.load(date);
+    fin_curves::myCurveView base = fin_curves::myCurveView(eur_ri_3m_fo.freeze());
+    fin_curves::myZeroRate usd_ri_3m_fo = fin_curves::myZeroRate(path, "usd_ri_3m_fo");
+    usd_ri_3m_fo.load(date);
+    fin_curves::myCurveView oth = fin_curves::myCurveView(usd_ri_3m_fo.freeze());
+
+    // composite curves share nodes of the base curves
+    double yr_frac = 2.0;
+    auto shifted = fin_curves::add_shift(base, 0.0001);
+    auto blended = fin_curves::blend(base, oth, 0.5);
+    auto spread = fin_curves::add_sprd(base, fin_curves::add_shift(blended, -0.0005));
+    std::cout << "Zero rates as of year fraction " << std::to_string(yr_frac) << ":" << std::endl;
+    std::cout << "   base curve: " << std::to_string(base.get_zr(yr_frac)) << std::endl;
+    std::cout << "   base curve shifted by +1bp: " << std::to_string(shifted.get_zr(yr_frac)) << std::endl;
+    std::cout << "   50/50 blend of EUR and USD curve: " << std::to_string(blended.get_zr(yr_frac)) << std::endl;
+    std::cout << "   base curve plus blend shifted by -5bp: " << std::to_string(spread.get_zr(yr_frac)) << std::endl;
+    std::cout << "   discount factor of shifted base curve: " << std::to_string(fin_curves::get_df(shifted, yr_frac)) << std::endl;
+
+    // parallel shift scenarios of the base curve; each scenario holds only its shift
+    std::cout << "Evaluating shift scenarios..." << std::endl;
+    lib_aux::tic();
+    std::vector<fin_curves::myShiftCurve<fin_curves::myCurveView>> scenarios;
+    for (int scenario_no = -500; scenario_no <= 500; scenario_no++)
+        scenarios.push_back(fin_curves::add_shift(base, 0.0001 * scenario_no));
+    std::vector<double> yr_fracs = {0.25, 0.5, 1.0, 2.0, 5.0, 10.0};
+    std::vector<double> dfs(yr_fracs.size());
+    double pv = 0.0;
+    for (const auto& scenario : scenarios)
+    {
+        fin_curves::get_dfs(scenario, yr_fracs.data(), dfs.data(), yr_fracs.size());
+        for (double df : dfs)
+            pv += df;
+    }
+    std::cout << "   " << std::to_string(scenarios.size()) << " scenarios evaluated in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "lib_str.h"
+#include "fin_generators.h"
+#include "fin_depoinstr.h"
+#include "fin_frainstr.h"
+
+int main()
+{
+    // create generators
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::vector<std::string> instrument_nms = {"EUR_3M_MANUAL", "EUR MM FIX", "EUR EURIBOR 3M RC"};
+    fin_curves::myGenerators generators = fin_curves::myGenerators(instrument_nms, path);
+    std::shared_ptr<fin_curves::generator> generator_depo = generators.get("EUR_3M_MANUAL");
+    std::shared_ptr<fin_curves::generator> generator_mm = generators.get("EUR MM FIX");
+    std::shared_ptr<fin_curves::generator> generator_fra = generators.get("EUR EURIBOR 3M RC");
+
+    // underlying zero rate curve
+    std::string crv_nm = "eur_ri_3m_fo";
+    std::string sep = ",";
+    fin_curves::myZeroRate crv = fin_curves::myZeroRate(path, crv_nm, sep);
+
+    // calculate discount factors of deposit instruments
+    std::string date_exec = "20220531";
+    std::string date_format = "yyyymmdd";
+    std::vector<std::string> tenors_depo = {"ON", "TN", "1M", "2M"};
+    std::vector<double> par_rates_depo = {-0.008452, -0.008452, -0.006815, -0.005172};
+
+    for (std::size_t idx = 0; idx < tenors_depo.size(); idx++)
+        fin_curves::myDepoInstr depo = fin_curves::myDepoInstr(date_exec, tenors_depo[idx], par_rates_depo[idx], generator_depo, crv, date_format);
+    fin_curves::myDepoInstr depo = fin_curves::myDepoInstr(date_exec, "3M", -0.00338, generator_mm, crv, date_format);
+
+    // evaluate strip of FRA instruments; the curve is not modified by the evaluation
+    std::vector<std::string> tenors_fra = {"4M", "5M", "6M", "7M", "8M", "9M", "10M", "11M"};
+    std::vector<double> par_rates_fra = {-0.00104, 0.00108, 0.00284, 0.0046, 0.00608, 0.00756, 0.00907, 0.01046};
+    std::vector<std::tuple<double, double>> yr_fracs_zrs = fin_curves::myFraInstr::eval(date_exec, tenors_fra, par_rates_fra, generator_fra, crv, date_format);
+
+    // print calculated zero rates
+    std::cout << instrument_nms[2] << std::endl;
+    std::cout << lib_str::repeate_char("=", 45) << std::endl;
+    std::cout << "|tenor  " << "|year fraction" << "|par rate  " << "|zr        " << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 45) << std::endl;
+    for (std::size_t idx = 0; idx < yr_fracs_zrs.size(); idx++)
+    {
+        std::cout << "|" << lib_str::add_trailing_char(tenors_fra[idx], 7) << "|" << lib_str::add_trailing_char(std::to_string(std::get<0>(yr_fracs_zrs[idx])), 13);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(par_rates_fra[idx]), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(yr_fracs_zrs[idx])), 10);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 45) << std::endl;
+
+    // everything OK
+    return 0;
+}
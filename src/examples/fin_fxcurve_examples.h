@@ -0,0 +1,28 @@
+#include "lib_str.h"
+#include "fin_fxcurve.h"
+
+int main()
+{
+    // load FX curve
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date = "20220531";
+    fin_curves::myFxCurve fx_crv = fin_curves::myFxCurve(path, "eur_usd");
+    fx_crv.load(date);
+
+    // print FX forwards
+    std::cout << fx_crv.get_crv_nm() << " spot " << std::to_string(fx_crv.get_spot()) << std::endl;
+    std::cout << lib_str::repeate_char("=", 26) << std::endl;
+    std::cout << "|year fraction" << "|fx        " << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 26) << std::endl;
+    std::vector<double> yr_fracs = {0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 30.0};
+    for (double yr_frac : yr_fracs)
+    {
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(yr_frac), 13);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(fx_crv.get_fx(yr_frac)), 10);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 26) << std::endl;
+
+    // everything OK
+    return 0;
+}
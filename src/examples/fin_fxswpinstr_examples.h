@@ -0,0 +1,52 @@
+#include "lib_str.h"
+#include "fin_generators.h"
+#include "fin_fxcurve.h"
+#include "fin_fxswpinstr.h"
+
+int main()
+{
+    // create generator
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::vector<std::string> instrument_nms = {"STFX_FXD_USDEUR"};
+    fin_curves::myGenerators generators = fin_curves::myGenerators(instrument_nms, path);
+    std::shared_ptr<fin_curves::generator> generator = generators.get("STFX_FXD_USDEUR");
+
+    // FX curve holding spot rate and ESTER curve bootstrapped beforehand
+    std::string date_exec = "20220531";
+    std::string date_format = "yyyymmdd";
+    fin_curves::myFxCurve fx_crv = fin_curves::myFxCurve(path, "eur_usd");
+    fx_crv.set_date(date_exec, date_format);
+    fx_crv.set_spot(1.0698);
+    fin_curves::myZeroRate oth_crv = fin_curves::myZeroRate(path, "eur_ri_ester");
+    oth_crv.load(date_exec, date_format);
+
+    // synthetic USD curve
+    fin_curves::myZeroRate crv = fin_curves::myZeroRate(path, "usd_synth_ester");
+    crv.set_date(date_exec, date_format);
+
+    // evaluate FX swaps one by one
+    std::vector<std::string> tenors = {"ON", "TN", "1W", "1M", "3M", "6M", "9M", "1Y", "15M", "18M"};
+    std::vector<double> fwd_pts = {0.00004148, 0.0000425, 0.000302, 0.001791, 0.00549, 0.011547, 0.018478, 0.024621, 0.0303735, 0.03524};
+
+    std::cout << instrument_nms[0] << std::endl;
+    std::cout << lib_str::repeate_char("=", 56) << std::endl;
+    std::cout << "|tenor  " << "|year fraction" << "|fwd pts   " << "|fx        " << "|zr        " << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 56) << std::endl;
+    for (std::size_t idx = 0; idx < tenors.size(); idx++)
+    {
+        fin_curves::myFxSwpInstr fxswp = fin_curves::myFxSwpInstr(date_exec, tenors[idx], fwd_pts[idx], generator, fx_crv, oth_crv, crv, date_format);
+        fx_crv.add(fxswp.get_yr_frac_fx());
+        crv.add(fxswp.get_yr_frac_zr());
+
+        // print FX forward and synthetic zero rate
+        std::cout << "|" << lib_str::add_trailing_char(tenors[idx], 7) << "|" << lib_str::add_trailing_char(std::to_string(std::get<0>(fxswp.get_yr_frac_fx())), 13);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(fwd_pts[idx]), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(fxswp.get_yr_frac_fx())), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(fxswp.get_yr_frac_zr())), 10);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 56) << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include "lib_str.h"
+#include "fin_generators.h"
+#include "fin_depoinstr.h"
+#include "fin_irsinstr.h"
+
+int main()
+{
+    // create generators
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::vector<std::string> instrument_nms = {"EUR_3M_MANUAL", "EUR MM FIX", "EUR_ESTCRV_3M"};
+    fin_curves::myGenerators generators = fin_curves::myGenerators(instrument_nms, path);
+    std::shared_ptr<fin_curves::generator> generator_depo = generators.get("EUR_3M_MANUAL");
+    std::shared_ptr<fin_curves::generator> generator_mm = generators.get("EUR MM FIX");
+    std::shared_ptr<fin_curves::generator> generator_irs = generators.get("EUR_ESTCRV_3M");
+
+    // discount curve bootstrapped beforehand
+    std::string date_exec = "20220531";
+    std::string date_format = "yyyymmdd";
+    std::shared_ptr<fin_curves::myZeroRate> dsc_crv = std::make_shared<fin_curves::myZeroRate>(path, "eur_ri_ester");
+    dsc_crv->load(date_exec, date_format);
+
+    // underlying zero rate curve with short end built from deposits
+    std::string crv_nm = "eur_ri_3m_fo";
+    fin_curves::myZeroRate crv = fin_curves::myZeroRate(path, crv_nm);
+    std::vector<std::string> tenors_depo = {"ON", "TN", "1M", "2M"};
+    std::vector<double> par_rates_depo = {-0.008452, -0.008452, -0.006815, -0.005172};
+    for (std::size_t idx = 0; idx < tenors_depo.size(); idx++)
+        fin_curves::myDepoInstr depo = fin_curves::myDepoInstr(date_exec, tenors_depo[idx], par_rates_depo[idx], generator_depo, crv, date_format);
+    fin_curves::myDepoInstr depo = fin_curves::myDepoInstr(date_exec, "3M", -0.00338, generator_mm, crv, date_format);
+
+    // solve strip of swaps; coupons preceding the last curve node are valued only once
+    std::vector<std::string> tenors_irs = {"1Y", "18M", "2Y", "3Y", "4Y", "5Y", "7Y", "10Y", "15Y", "20Y", "30Y"};
+    std::vector<double> par_rates_irs = {0.00479, 0.00845, 0.01065, 0.0127, 0.01394, 0.01485, 0.01627, 0.01832, 0.02025, 0.01985, 0.01787};
+    fin_curves::myIrsInstr irs = fin_curves::myIrsInstr(date_exec, generator_irs, crv, dsc_crv, date_format);
+
+    std::cout << instrument_nms[2] << std::endl;
+    std::cout << lib_str::repeate_char("=", 50) << std::endl;
+    std::cout << "|tenor  " << "|year fraction" << "|par rate  " << "|zr        " << "|iters" << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 50) << std::endl;
+    for (std::size_t idx = 0; idx < tenors_irs.size(); idx++)
+    {
+        std::tuple<double, double> yr_frac_zr = irs.solve(tenors_irs[idx], par_rates_irs[idx], crv);
+        crv.add(yr_frac_zr);
+
+        // print calculated zero rate
+        std::cout << "|" << lib_str::add_trailing_char(tenors_irs[idx], 7) << "|" << lib_str::add_trailing_char(std::to_string(std::get<0>(yr_frac_zr)), 13);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(par_rates_irs[idx]), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(yr_frac_zr)), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(irs.get_iters_no()), 5);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 50) << std::endl;
+
+    // everything OK
+    return 0;
+}
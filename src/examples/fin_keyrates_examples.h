@@ -0,0 +1,72 @@
+#include <iostream>
+#include <thread>
+#include <algorithm>
+#include "lib_aux.h"
+#include "lib_str.h"
+#include "fin_scheduler.h"
+#include "fin_keyrates.h"
+
+int main()
+{
+    std::cout << "KEY RATES" << std::endl;
+
+    // bootstrap scheduled curves
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date = "20220531";
+    fin_curves::myScheduler scheduler = fin_curves::myScheduler(path);
+    scheduler.load("eur_usd_close");
+    scheduler.set_fx_spot("eur_usd", 1.0698);
+    scheduler.set_suffix("_pokus");
+    std::cout << "Bootstrapping curves..." << std::endl;
+    scheduler.run(date);
+
+    // portfolio of 3M EURIBOR and 3M USD LIBOR swaps; the valuation only reads the curves, so it can be called by several threads at once
+    fin_curves::pricer value = [](const std::map<std::string, std::shared_ptr<const fin_curves::myZeroRate>>& crvs) -> double
+    {
+        double pv = 0.0;
+        for (std::string crv_nm : {"eur_ri_3m_fo", "usd_ri_3m_fo"})
+        {
+            const fin_curves::myZeroRate& crv = *crvs.at(crv_nm);
+            for (std::size_t cpn = 1; cpn <= 40; cpn++)
+            {
+                double df_start = (cpn == 1) ? 1.0 : crv.get_df(0.25 * (cpn - 1));
+                double df_end = crv.get_df(0.25 * cpn);
+                pv += 1000000.0 * (df_start - df_end - 0.25 * 0.012 * df_end);
+            }
+        }
+        return pv;
+    };
+
+    // bump each quote of each curve by 1bp
+    std::cout << "Calculating bucketed DV01..." << std::endl;
+    fin_curves::myKeyRates key_rates = fin_curves::myKeyRates(path);
+    lib_aux::tic();
+    std::size_t crvs_ok_no = key_rates.run(scheduler, date, value);
+    std::cout << "   " << std::to_string(crvs_ok_no) << " curves processed in " << std::to_string(lib_aux::toc()) << " seconds using ";
+    std::cout << std::to_string(std::thread::hardware_concurrency()) << " threads" << std::endl;
+
+    // print the first buckets; the SOFR curve is not valued directly, its DV01 comes from the 3M USD LIBOR curve bootstrapped again against the bumped SOFR
+    // curve
+    std::vector<std::string> crv_nms = key_rates.get_crv_nms();
+    std::vector<std::string> buckets = key_rates.get_buckets();
+    std::vector<std::vector<double>> dv01s = key_rates.get_dv01s();
+    std::cout << "|bucket " << "|" << lib_str::add_trailing_char("eur_ri_3m_fo", 14) << "|" << lib_str::add_trailing_char("usd_ri_3m_fo", 14);
+    std::cout << "|" << lib_str::add_trailing_char("usd_ri_sofr", 14) << "|" << std::endl;
+    std::size_t eur_idx = std::find(crv_nms.begin(), crv_nms.end(), "eur_ri_3m_fo") - crv_nms.begin();
+    std::size_t usd_idx = std::find(crv_nms.begin(), crv_nms.end(), "usd_ri_3m_fo") - crv_nms.begin();
+    std::size_t sofr_idx = std::find(crv_nms.begin(), crv_nms.end(), "usd_ri_sofr") - crv_nms.begin();
+    for (std::size_t idx = 0; idx < std::min((std::size_t)12, buckets.size()); idx++)
+    {
+        std::cout << "|" << lib_str::add_trailing_char(buckets[idx], 7) << "|" << lib_str::add_trailing_char(std::to_string(dv01s[idx][eur_idx]), 14);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(dv01s[idx][usd_idx]), 14) << "|" << lib_str::add_trailing_char(std::to_string(dv01s[idx][sofr_idx]), 14) << "|" << std::endl;
+    }
+
+    // store bucket x curve matrices into .csv files
+    std::cout << "Saving DV01 and key rate durations into .csv files..." << std::endl;
+    key_rates.save();
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "lib_str.h"
+#include "fin_generators.h"
+#include "fin_depoinstr.h"
+#include "fin_oisinstr.h"
+
+int main()
+{
+    // create generators
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::vector<std::string> instrument_nms = {"USD SOFR FIXING", "USD SOFR CURVE"};
+    fin_curves::myGenerators generators = fin_curves::myGenerators(instrument_nms, path);
+    std::shared_ptr<fin_curves::generator> generator_depo = generators.get("USD SOFR FIXING");
+    std::shared_ptr<fin_curves::generator> generator_ois = generators.get("USD SOFR CURVE");
+
+    // underlying zero rate curve
+    std::string crv_nm = "usd_ri_sofr";
+    std::string sep = ",";
+    fin_curves::myZeroRate crv = fin_curves::myZeroRate(path, crv_nm, sep);
+
+    // overnight fixing
+    std::string date_exec = "20220531";
+    std::string date_format = "yyyymmdd";
+    fin_curves::myDepoInstr depo = fin_curves::myDepoInstr(date_exec, "ON", 0.0078, generator_depo, crv, date_format);
+
+    // evaluate OIS instruments one by one and add them to the curve
+    std::vector<std::string> tenors_ois = {"1W", "1M", "3M", "6M", "1Y", "18M", "2Y", "5Y", "10Y", "30Y", "50Y"};
+    std::vector<double> par_rates_ois = {0.00786, 0.00858, 0.01195, 0.01676, 0.02216, 0.02566, 0.02695, 0.02693, 0.02686, 0.02466, 0.02155};
+
+    std::cout << instrument_nms[1] << std::endl;
+    std::cout << lib_str::repeate_char("=", 50) << std::endl;
+    std::cout << "|tenor  " << "|year fraction" << "|par rate  " << "|zr        " << "|iters" << "|" << std::endl;
+    std::cout << lib_str::repeate_char("=", 50) << std::endl;
+    for (std::size_t idx = 0; idx < tenors_ois.size(); idx++)
+    {
+        fin_curves::myOisInstr ois = fin_curves::myOisInstr(date_exec, tenors_ois[idx], par_rates_ois[idx], generator_ois, crv, date_format);
+        crv.add(ois.get_yr_frac_zr());
+
+        // print calculated zero rate
+        std::cout << "|" << lib_str::add_trailing_char(tenors_ois[idx], 7) << "|" << lib_str::add_trailing_char(std::to_string(std::get<0>(ois.get_yr_frac_zr())), 13);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(par_rates_ois[idx]), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(std::get<1>(ois.get_yr_frac_zr())), 10);
+        std::cout << "|" << lib_str::add_trailing_char(std::to_string(ois.get_iters_no()), 5);
+        std::cout << "|" << std::endl;
+    }
+    std::cout << lib_str::repeate_char("=", 50) << std::endl;
+
+    // everything OK
+    return 0;
+}
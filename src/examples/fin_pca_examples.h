@@ -0,0 +1,100 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <thread>
+#include "lib_aux.h"
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_scenarios.h"
+#include "fin_pca.h"
+
+int main()
+{
+    std::cout << "PRINCIPAL COMPONENTS OF CURVE CHANGES" << std::endl;
+
+    // tenor grid of 60 tenors up to 30 years
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::vector<double> yr_fracs;
+    for (std::size_t idx = 1; idx <= 60; idx++)
+        yr_fracs.push_back(0.5 * idx);
+
+    // history of saved curves
+    std::cout << "Loading history of saved curves..." << std::endl;
+    fin_curves::myPca pca_saved = fin_curves::myPca(path, "eur_ri_3m_fo");
+    std::size_t dates_no = pca_saved.load("20000101", "20991231", yr_fracs);
+    std::cout << "   " << std::to_string(dates_no) << " of " << std::to_string(pca_saved.get_dates().size()) << " curves loaded" << std::endl;
+
+    // 20 years of daily curves simulated from the last saved curve by level, slope and curvature moves
+    std::cout << "Simulating 20 years of daily curves..." << std::endl;
+    fin_curves::myZeroRate crv = fin_curves::myZeroRate(path, "eur_ri_3m_fo");
+    crv.load("20220531");
+    std::vector<double> zrs_day;
+    for (double yr_frac : yr_fracs)
+        zrs_day.push_back(crv.get_zr(yr_frac));
+    std::mt19937 generator(20220531);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    lib_date::myDate date = lib_date::myDate("20020531", "yyyymmdd");
+    std::vector<std::string> dates;
+    std::vector<std::vector<double>> zrs;
+    for (std::size_t day = 0; day < 20 * 252; day++)
+    {
+        date.add_working_days(std::vector<lib_date::myDate>());
+        double level = 0.0005 * normal(generator);
+        double slope = 0.0002 * normal(generator);
+        double curvature = 0.0001 * normal(generator);
+        for (std::size_t tenor = 0; tenor < yr_fracs.size(); tenor++)
+        {
+            double x = yr_fracs[tenor] / 30.0 - 0.5;
+            zrs_day[tenor] += level + slope * x + curvature * (4.0 * x * x - 1.0 / 3.0) + 0.00001 * normal(generator);
+        }
+        dates.push_back(date.get_date_str());
+        zrs.push_back(zrs_day);
+    }
+
+    // decompose daily changes
+    fin_curves::myPca pca = fin_curves::myPca(path, "eur_ri_3m_fo");
+    pca.load(dates, yr_fracs, zrs);
+    lib_aux::tic();
+    pca.run();
+    std::cout << "   " << std::to_string(pca.get_chgs().size()) << " daily changes of " << std::to_string(yr_fracs.size()) << " tenors decomposed in ";
+    std::cout << std::to_string(lib_aux::toc()) << " seconds using " << std::to_string(std::thread::hardware_concurrency()) << " threads" << std::endl;
+
+    // leading components
+    std::vector<double> eig_vals = pca.get_eig_vals();
+    std::vector<double> explained = pca.get_explained();
+    std::vector<std::vector<double>> eig_vecs = pca.get_eig_vecs(3);
+    for (std::size_t comp = 0; comp < eig_vecs.size(); comp++)
+    {
+        std::cout << "   component " << std::to_string(comp + 1) << " - explained variance: " << std::to_string(explained[comp]);
+        std::cout << "; loadings 1Y/10Y/30Y: " << std::to_string(eig_vecs[comp][1]) << "/" << std::to_string(eig_vecs[comp][19]) << "/" << std::to_string(eig_vecs[comp][59]) << std::endl;
+    }
+
+    // +/-2 standard deviation moves along the leading components as curve scenarios
+    std::vector<std::vector<double>> shifts;
+    for (std::size_t comp = 0; comp < eig_vecs.size(); comp++)
+    {
+        for (double sign : {-2.0, 2.0})
+        {
+            std::vector<double> shifts_scenario;
+            for (double loading : eig_vecs[comp])
+                shifts_scenario.push_back(sign * std::sqrt(eig_vals[comp]) * loading);
+            shifts.push_back(shifts_scenario);
+        }
+    }
+    fin_curves::myScenarios scenarios = fin_curves::myScenarios(crv.freeze(), shifts.size());
+    scenarios.add_hist(yr_fracs, shifts);
+    std::vector<double> dfs(shifts.size());
+    scenarios.get_dfs(10.0, dfs.data());
+    std::cout << "   base curve - 10Y discount factor: " << std::to_string(crv.get_df(10.0)) << std::endl;
+    for (std::size_t scenario = 0; scenario < shifts.size(); scenario++)
+        std::cout << "   scenario " << std::to_string(scenario) << " - 10Y discount factor: " << std::to_string(dfs[scenario]) << std::endl;
+
+    // save leading components
+    pca.save(3);
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include "lib_aux.h"
+#include "fin_scenarios.h"
+
+int main()
+{
+    std::cout << "CURVE SCENARIOS" << std::endl;
+
+    // base curve
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date = "20220531";
+    std::shared_ptr<fin_curves::myZeroRate> crv = std::make_shared<fin_curves::myZeroRate>(path, "eur_ri_3m_fo");
+    crv->load(date);
+
+    // parallel shifts from -200bp to +200bp combined with steepeners and bucketed 5Y shifts
+    std::cout << "Applying shocks..." << std::endl;
+    std::size_t scenarios_no = 10000;
+    std::vector<double> shifts_parallel;
+    std::vector<double> shifts_short;
+    std::vector<double> shifts_long;
+    std::vector<double> shifts_bucket;
+    for (std::size_t scenario = 0; scenario < scenarios_no; scenario++)
+    {
+        shifts_parallel.push_back(0.0001 * ((double)(scenario % 41) - 20.0) * 10.0);
+        shifts_short.push_back(-0.0005 * (scenario % 3));
+        shifts_long.push_back(0.0005 * (scenario % 3));
+        shifts_bucket.push_back(0.0001 * (scenario % 5));
+    }
+    lib_aux::tic();
+    fin_curves::myScenarios scenarios = fin_curves::myScenarios(crv->freeze(), scenarios_no);
+    scenarios.add_parallel(shifts_parallel);
+    scenarios.add_twist(2.0, 10.0, shifts_short, shifts_long);
+    scenarios.add_bucket(4.0, 5.0, 7.0, shifts_bucket);
+    std::cout << "   " << std::to_string(scenarios_no) << " scenarios created in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+
+    // discount factors of a quarterly schedule up to 30 years for all scenarios
+    std::cout << "Calculating discount factors..." << std::endl;
+    std::vector<double> yr_fracs;
+    for (std::size_t idx = 1; idx <= 120; idx++)
+        yr_fracs.push_back(0.25 * idx);
+    lib_aux::tic();
+    std::vector<double> dfs = scenarios.get_dfs(yr_fracs, 0);
+    std::cout << "   " << std::to_string(dfs.size()) << " discount factors calculated in " << std::to_string(lib_aux::toc()) << " seconds using ";
+    std::cout << std::to_string(std::thread::hardware_concurrency()) << " threads" << std::endl;
+
+    // 10Y discount factor of the base curve and of the first scenarios
+    std::size_t idx_10y = 39;
+    std::cout << "   base curve - 10Y discount factor: " << std::to_string(crv->get_df(yr_fracs[idx_10y])) << std::endl;
+    for (std::size_t scenario = 0; scenario < 3; scenario++)
+        std::cout << "   scenario " << std::to_string(scenario) << " - 10Y discount factor: " << std::to_string(dfs[idx_10y * scenarios_no + scenario]) << std::endl;
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <thread>
+#include "lib_aux.h"
+#include "fin_scheduler.h"
+
+int main()
+{
+    std::cout << "CURVE SCHEDULER" << std::endl;
+
+    // EUR and USD curves are bootstrapped concurrently; synthetic USD curve waits for 3M projection curves of both currencies
+    std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+    std::string date = "20220531";
+    fin_curves::myScheduler scheduler = fin_curves::myScheduler(path);
+    scheduler.load("eur_usd_close");
+    scheduler.set_fx_spot("eur_usd", 1.0698);
+    scheduler.set_suffix("_pokus");
+
+    // print curves in the order of their dependencies
+    std::cout << "Curve dependencies:" << std::endl;
+    for (std::string crv_nm : scheduler.get_order())
+        std::cout << "   " << crv_nm << std::endl;
+
+    // valuation threads read curves through handles; they keep reading the previous snapshot while the curves are being rebuilt
+    std::shared_ptr<fin_curves::myZeroRateHandle> handle = scheduler.get_handle("eur_ri_3m_fo");
+
+    // bootstrap curves
+    std::cout << "Bootstrapping curves..." << std::endl;
+    lib_aux::tic();
+    std::size_t crvs_ok_no = scheduler.run(date);
+    double time = lib_aux::toc();
+    std::cout << "   " << std::to_string(crvs_ok_no) << " out of " << std::to_string(scheduler.get_crv_nms().size()) << " curves bootstrapped in " << std::to_string(time);
+    std::cout << " seconds using " << std::to_string(std::thread::hardware_concurrency()) << " threads" << std::endl;
+
+    // print failed curves
+    std::vector<std::string> crv_nms = scheduler.get_crv_nms();
+    std::vector<std::string> errs = scheduler.get_errs();
+    for (std::size_t idx = 0; idx < crv_nms.size(); idx++)
+    {
+        if (errs[idx].size() > 0)
+            std::cout << "   " << crv_nms[idx] << ": " << errs[idx] << std::endl;
+    }
+
+    // read the published snapshot
+    std::shared_ptr<const fin_curves::myZeroRate> snapshot = handle->get();
+    if (snapshot != nullptr)
+        std::cout << "Published eur_ri_3m_fo snapshot - discount factor as of year fraction 2.0: " << std::to_string(snapshot->get_df(2.0)) << std::endl;
+
+    std::cout << '\n' << std::endl;
+
+    // everything OK
+    return 0;
+}
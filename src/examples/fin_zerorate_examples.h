@@ -1,4 +1,9 @@
 #include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "lib_aux.h"
+#include "lib_date.h"
 #include "fin_zerorate.h"
 
 int main()
@@ -46,7 +51,7 @@ int main()
 
     std::vector<double> yr_fracs = {0.0931507, 0.2575342, 0.5068493, 0.7534247, 1.0054795, 2.0109589, 3.0082192, 4.0082192, 5.0082192};
     std::vector<double> zrs = {-0.0069821, -0.0034579, -0.0003441, 0.0022772, 0.0047364, 0.0106236, 0.0127052, 0.0139706, 0.0149029};
-    eur_ri_3m_fo.load(date, yr_fracs, zrs, path);
+    eur_ri_3m_fo.load(date, yr_fracs, zrs, date_format);
 
     // zero rate and discount factor
     std::cout << "Calculating zero rate and discount factor..." << std::endl;
@@ -55,13 +60,113 @@ int main()
     df = eur_ri_3m_fo.get_df(yr_frac);
     std::cout << "   year fraction: " << std::to_string(yr_frac) << " - zero rate: " << std::to_string(zr) << ", discount factor: " << std::to_string(df) << std::endl;
 
+    // forward rates of a 3M floating leg schedule; discount factors of the coupon dates are shared by the adjacent coupons
+    std::cout << "Calculating forward rates..." << std::endl;
+    std::vector<double> yr_fracs_cpn = {0.0, 0.25, 0.5, 0.75, 1.0};
+    std::vector<double> fwds = eur_ri_3m_fo.get_fwds(yr_fracs_cpn);
+    for (std::size_t idx = 0; idx < fwds.size(); idx++)
+        std::cout << "   " << std::to_string(yr_fracs_cpn[idx]) << " x " << std::to_string(yr_fracs_cpn[idx + 1]) << " - forward rate: " << std::to_string(fwds[idx]) << std::endl;
+
+    // queries ordered by year fraction find their segment through the segment of the previous query, i.e. without binary search; the same queries in
+    // random order miss the hint and fall back to binary search, but return the same zero rates
+    std::cout << "Looking up zero rates with and without segment hint..." << std::endl;
+    fin_curves::myZeroRate eur_ri_3m_fo_hint = fin_curves::myZeroRate(path, crv_nm, sep, quotes);
+    eur_ri_3m_fo_hint.load(date, date_format);
+    std::vector<double> yr_fracs_hint;
+    for (std::size_t idx = 1; idx <= 600; idx++)
+        yr_fracs_hint.push_back(idx / 12.0);
+    std::vector<double> yr_fracs_rnd = yr_fracs_hint;
+    std::shuffle(yr_fracs_rnd.begin(), yr_fracs_rnd.end(), std::mt19937(20220531));
+
+    std::vector<double> zrs_hint(yr_fracs_hint.size());
+    std::vector<double> zrs_rnd(yr_fracs_rnd.size());
+    std::size_t reps_no = 1000;
+    lib_aux::tic();
+    for (std::size_t rep = 0; rep < reps_no; rep++)
+    {
+        for (std::size_t idx = 0; idx < yr_fracs_hint.size(); idx++)
+            zrs_hint[idx] = eur_ri_3m_fo_hint.get_zr(yr_fracs_hint[idx]);
+    }
+    double time_hint = lib_aux::toc();
+    lib_aux::tic();
+    for (std::size_t rep = 0; rep < reps_no; rep++)
+    {
+        for (std::size_t idx = 0; idx < yr_fracs_rnd.size(); idx++)
+            zrs_rnd[idx] = eur_ri_3m_fo_hint.get_zr(yr_fracs_rnd[idx]);
+    }
+    double time_rnd = lib_aux::toc();
+
+    bool is_identical = true;
+    for (std::size_t idx = 0; idx < yr_fracs_rnd.size(); idx++)
+    {
+        std::size_t idx_hint = std::find(yr_fracs_hint.begin(), yr_fracs_hint.end(), yr_fracs_rnd[idx]) - yr_fracs_hint.begin();
+        is_identical = is_identical && (zrs_rnd[idx] == zrs_hint[idx_hint]);
+    }
+    std::cout << "   " << std::to_string(reps_no * yr_fracs_hint.size()) << " ordered queries (hint) in " << std::to_string(time_hint) << " seconds" << std::endl;
+    std::cout << "   " << std::to_string(reps_no * yr_fracs_rnd.size()) << " random queries (binary search) in " << std::to_string(time_rnd) << " seconds" << std::endl;
+    std::cout << "   identical zero rates: " << (is_identical ? "yes" : "no") << std::endl;
+
+    // discount factors of calendar days from the curve date till the last curve node are evaluated into a daily grid by the first query and then only
+    // looked up; days beyond the last curve node fall back to date arithmetic and day count method
+    std::cout << "Looking up discount factors of calendar days..." << std::endl;
+    std::size_t days_grid = (std::size_t)(eur_ri_3m_fo_hint.get_yr_fracs().back() * 360.0);
+    std::vector<double> dfs_grid(days_grid);
+    std::vector<double> dfs_beyond(days_grid);
+    lib_aux::tic();
+    eur_ri_3m_fo_hint.get_df_day(0);
+    std::cout << "   grid built in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+    lib_aux::tic();
+    for (std::size_t days_no = 0; days_no < days_grid; days_no++)
+        dfs_grid[days_no] = eur_ri_3m_fo_hint.get_df_day(days_no);
+    double time_grid = lib_aux::toc();
+    lib_aux::tic();
+    for (std::size_t days_no = 0; days_no < days_grid; days_no++)
+        dfs_beyond[days_no] = eur_ri_3m_fo_hint.get_df_day(2 * days_grid + days_no);
+    double time_beyond = lib_aux::toc();
+    std::cout << "   " << std::to_string(days_grid) << " days within the grid in " << std::to_string(time_grid) << " seconds" << std::endl;
+    std::cout << "   " << std::to_string(days_grid) << " days beyond the grid in " << std::to_string(time_beyond) << " seconds" << std::endl;
+    std::cout << "   day 730 - discount factor: " << std::to_string(dfs_grid[730]) << std::endl;
+
+    // the same curve queried by dates; year fractions follow day count method of the curve
+    std::cout << "Calculating discount factors of dates..." << std::endl;
+    lib_date::myDate date_cpn = lib_date::myDate(date, date_format);
+    std::vector<lib_date::myDate> dates_cpn;
+    std::vector<std::size_t> days_nos_cpn;
+    for (std::size_t idx = 0; idx < 4; idx++)
+    {
+        date_cpn.add("3M");
+        dates_cpn.push_back(date_cpn);
+        days_nos_cpn.push_back(date_cpn.get_days_no());
+    }
+    std::vector<double> dfs_cpn = eur_ri_3m_fo_hint.get_dfs(dates_cpn);
+    std::vector<double> dfs_days_cpn(days_nos_cpn.size());
+    eur_ri_3m_fo_hint.get_dfs_days(days_nos_cpn.data(), dfs_days_cpn.data(), days_nos_cpn.size());
+    for (std::size_t idx = 0; idx < dates_cpn.size(); idx++)
+    {
+        std::cout << "   " << dates_cpn[idx].get_date_str() << " - year fraction: " << std::to_string(eur_ri_3m_fo_hint.get_yr_frac(dates_cpn[idx]));
+        std::cout << ", discount factor: " << std::to_string(eur_ri_3m_fo_hint.get_df(dates_cpn[idx])) << " (vector of dates: " << std::to_string(dfs_cpn[idx]);
+        std::cout << ", serial day numbers: " << std::to_string(dfs_days_cpn[idx]) << ")" << std::endl;
+    }
+
     // store interpolation definition into a .csv file
     std::cout << "Saving interpolation definition into a .csv file..." << std::endl;
     eur_ri_3m_fo.save_def();
 
     // store data into a .csv file
     std::cout << "Saving data into a .csv file..." << std::endl;
-    eur_ri_3m_fo.save_data();
+    eur_ri_3m_fo.save_data(",", "_pokus");
+
+    // the same zero rates interpolated by cubic spline and through discount factors
+    std::cout << "Calculating zero rate and discount factor using other interpolations..." << std::endl;
+    for (std::string zr_interp : {"cubic", "log_linear", "monotone_convex"})
+    {
+        interp_def.zr_interp = zr_interp;
+        fin_curves::myZeroRate eur_ri_3m_fo_oth = fin_curves::myZeroRate(crv_nm, interp_def, path);
+        eur_ri_3m_fo_oth.load(date, yr_fracs, zrs, date_format);
+        zr = eur_ri_3m_fo_oth.get_zr(yr_frac);
+        df = eur_ri_3m_fo_oth.get_df(yr_frac);
+        std::cout << "   " << zr_interp << " - year fraction: " << std::to_string(yr_frac) << " - zero rate: " << std::to_string(zr) << ", discount factor: " << std::to_string(df) << std::endl;
+    }
 
     std::cout << '\n' << std::endl;
 
@@ -0,0 +1,125 @@
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include "lib_dual.h"
+#include "fin_curves.h"
+#include "fin_adjcurve.h"
+
+// construct curve recorded on tape
+fin_curves::myAdjointCurve::myAdjointCurve(const std::shared_ptr<const fin_curves::myZeroRate>& crv, lib_math::myTape& tape)
+{
+    if ((crv == nullptr) || (crv->get_size() == 0))
+        throw std::runtime_error((std::string)__func__ + ": Zero rate curve is missing or empty!");
+    std::string zr_interp = crv->get_def().zr_interp;
+    if ((zr_interp.compare("linear") != 0) && (zr_interp.compare("log_linear") != 0))
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + crv->get_crv_nm() + "' - only linear and log_linear interpolations are supported!");
+
+    this->crv = crv;
+    this->tape = &tape;
+    this->yr_fracs = crv->get_yr_fracs();
+    this->zr_type = crv->get_def().zr_type;
+    this->log_linear = (zr_interp.compare("log_linear") == 0);
+    for (std::size_t idx = 0; idx < this->yr_fracs.size(); idx++)
+        this->zrs.push_back(lib_math::adjoint::input(tape, crv->get_zr(idx)));
+}
+
+// find the two nodes interpolating zero rate and weight of the upper node; zero rates are flat beyond the first and the last node
+void fin_curves::myAdjointCurve::find_nodes(const double& yr_frac, std::size_t& idx_lo, std::size_t& idx_hi, double& weight) const
+{
+    std::size_t nodes_no = this->yr_fracs.size();
+    if ((nodes_no == 1) || (yr_frac <= this->yr_fracs[0]))
+    {
+        idx_lo = 0;
+        idx_hi = 0;
+        weight = 0.0;
+    }
+    else if (yr_frac >= this->yr_fracs[nodes_no - 1])
+    {
+        idx_lo = nodes_no - 1;
+        idx_hi = nodes_no - 1;
+        weight = 0.0;
+    }
+    else
+    {
+        idx_hi = std::upper_bound(this->yr_fracs.begin(), this->yr_fracs.end(), yr_frac) - this->yr_fracs.begin();
+        idx_lo = idx_hi - 1;
+        weight = (yr_frac - this->yr_fracs[idx_lo]) / (this->yr_fracs[idx_hi] - this->yr_fracs[idx_lo]);
+    }
+}
+
+// interpolate logarithm of discount factor between two distinct curve nodes
+lib_math::dual<2> fin_curves::myAdjointCurve::interp_df(const std::size_t& idx_lo, const std::size_t& idx_hi, const double& weight) const
+{
+    // node zero rates are seeded into separate lanes, so that a single pass gives derivatives with respect to both of them
+    lib_math::dual<2> log_df_lo = log(fin_curves::zr_to_df(lib_math::dual<2>::seed(this->zrs[idx_lo].val, 0), this->yr_fracs[idx_lo], this->zr_type));
+    lib_math::dual<2> log_df_hi = log(fin_curves::zr_to_df(lib_math::dual<2>::seed(this->zrs[idx_hi].val, 1), this->yr_fracs[idx_hi], this->zr_type));
+    return exp((1.0 - weight) * log_df_lo + weight * log_df_hi);
+}
+
+// get zero rate
+lib_math::adjoint fin_curves::myAdjointCurve::get_zr(const double& yr_frac) const
+{
+    // interpolation is recorded as a single operation with the two surrounding nodes as arguments
+    std::size_t idx_lo, idx_hi;
+    double weight;
+    this->find_nodes(yr_frac, idx_lo, idx_hi, weight);
+    if (idx_lo == idx_hi)
+        return this->zrs[idx_lo];
+
+    const lib_math::adjoint& zr_lo = this->zrs[idx_lo];
+    const lib_math::adjoint& zr_hi = this->zrs[idx_hi];
+    if (this->log_linear)
+    {
+        lib_math::dual<2> zr = fin_curves::df_to_zr(this->interp_df(idx_lo, idx_hi, weight), yr_frac, this->zr_type);
+        return lib_math::record(zr.val, zr_lo, zr.grad[0], zr_hi, zr.grad[1]);
+    }
+    return lib_math::record(zr_lo.val + (zr_hi.val - zr_lo.val) * weight, zr_lo, 1.0 - weight, zr_hi, weight);
+}
+
+// get discount factor
+lib_math::adjoint fin_curves::myAdjointCurve::get_df(const double& yr_frac) const
+{
+    if (yr_frac <= 0.0)
+        return lib_math::adjoint(1.0);
+
+    // interpolation and conversion into discount factor are recorded as a single operation; derivative of the conversion is evaluated by a dual number
+    std::size_t idx_lo, idx_hi;
+    double weight;
+    this->find_nodes(yr_frac, idx_lo, idx_hi, weight);
+    const lib_math::adjoint& zr_lo = this->zrs[idx_lo];
+    const lib_math::adjoint& zr_hi = this->zrs[idx_hi];
+    if (this->log_linear && (idx_lo != idx_hi))
+    {
+        lib_math::dual<2> df = this->interp_df(idx_lo, idx_hi, weight);
+        return lib_math::record(df.val, zr_lo, df.grad[0], zr_hi, df.grad[1]);
+    }
+    lib_math::dual<1> df = fin_curves::zr_to_df(lib_math::dual<1>::seed(zr_lo.val + (zr_hi.val - zr_lo.val) * weight, 0), yr_frac, this->zr_type);
+    if (idx_lo == idx_hi)
+        return lib_math::record(df.val, zr_lo, df.grad[0]);
+    return lib_math::record(df.val, zr_lo, (1.0 - weight) * df.grad[0], zr_hi, weight * df.grad[0]);
+}
+
+// get adjoints of node zero rates
+std::vector<double> fin_curves::myAdjointCurve::get_zrs_adj() const
+{
+    std::vector<double> zrs_adj;
+    for (const lib_math::adjoint& zr : this->zrs)
+        zrs_adj.push_back(this->tape->get_adj(zr.pos));
+    return zrs_adj;
+}
+
+// add adjoints of discount factors to adjoints of node zero rates
+void fin_curves::myAdjointCurve::add_dfs_adj(const std::vector<std::tuple<double, double>>& dfs_adj)
+{
+    // adjoints of the nodes are accumulated by sweeping only the recorded discount factors
+    std::size_t pos_start = this->tape->get_size();
+    for (const auto& [yr_frac, adj] : dfs_adj)
+    {
+        lib_math::adjoint df = this->get_df(yr_frac);
+        if (df.tape != nullptr)
+            this->tape->add_adj(df.pos, adj);
+    }
+    this->tape->sweep(pos_start);
+    this->tape->rewind(pos_start);
+}
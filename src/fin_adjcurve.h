@@ -0,0 +1,108 @@
+/** \example fin_adjcurve_examples.h
+ * @file fin_adjcurve.h
+ * @author Michal Mackanic
+ * @brief Zero rate curve recorded on tape for reverse-mode (adjoint) sensitivities of valuations to curve nodes and, through bootstrap, to market quotes.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include "lib_tape.h"
+#include "lib_dual.h"
+#include "fin_zerorate.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Frozen zero rate curve whose node zero rates are inputs of a tape. Zero rates and discount factors queried from the curve are recorded on the
+     * tape, so that a single backward sweep from a valuation, e.g. value of a portfolio, gives adjoints of all node zero rates; myBootstrap::get_quotes_adj()
+     * carries them further to market quotes. The frozen curve is the checkpoint between valuation and bootstrap, i.e. nothing of the bootstrap is recorded.
+     *
+     */
+    class myAdjointCurve
+    {
+        private:
+            std::shared_ptr<const fin_curves::myZeroRate> crv;
+            lib_math::myTape* tape;
+            std::vector<double> yr_fracs;
+            std::vector<lib_math::adjoint> zrs;
+            unsigned short zr_type;
+            bool log_linear;
+
+            /**
+             * @brief Find curve nodes interpolating zero rate for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @param idx_lo Position index of the lower node.
+             * @param idx_hi Position index of the upper node; equal to the lower node beyond the first and the last node.
+             * @param weight Weight of the upper node.
+             */
+            void find_nodes(const double& yr_frac, std::size_t& idx_lo, std::size_t& idx_hi, double& weight) const;
+
+            /**
+             * @brief Interpolate logarithm of discount factor between two distinct curve nodes, i.e. log-linear interpolation of discount factors.
+             *
+             * @param idx_lo Position index of the lower node.
+             * @param idx_hi Position index of the upper node.
+             * @param weight Weight of the upper node.
+             * @return lib_math::dual<2> Discount factor together with its derivatives with respect to zero rates of the lower and the upper node.
+             */
+            lib_math::dual<2> interp_df(const std::size_t& idx_lo, const std::size_t& idx_hi, const double& weight) const;
+
+        public:
+            /**
+             * @brief Construct a new myAdjointCurve object; zero rates of curve nodes are recorded on the tape as inputs.
+             *
+             * @param crv Frozen zero rate curve, see myZeroRate::freeze(); only linear interpolation of zero rates and log-linear interpolation of discount
+             * factors are supported.
+             * @param tape Tape the curve queries are recorded on; it must outlive the object.
+             */
+            myAdjointCurve(const std::shared_ptr<const fin_curves::myZeroRate>& crv, lib_math::myTape& tape);
+
+            /**
+             * @brief Get zero rate for a year fraction; zero rates are flat beyond the first and the last node.
+             *
+             * @param yr_frac Year fraction.
+             * @return lib_math::adjoint Zero rate.
+             */
+            lib_math::adjoint get_zr(const double& yr_frac) const;
+
+            /**
+             * @brief Get discount factor for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @return lib_math::adjoint Discount factor.
+             */
+            lib_math::adjoint get_df(const double& yr_frac) const;
+
+            /**
+             * @brief Get adjoints of zero rates of curve nodes after backward sweep of the tape.
+             *
+             * @return std::vector<double> Adjoints of zero rates of curve nodes.
+             */
+            std::vector<double> get_zrs_adj() const;
+
+            /**
+             * @brief Add adjoints of discount factors to adjoints of zero rates of curve nodes, e.g. adjoints of discount factors of the discount curve of
+             * another curve, see myBootstrap::get_quotes_adj(). Discount factors are recorded at the end of the tape, swept on their own and discarded.
+             *
+             * @param dfs_adj Adjoints of discount factors as pairs of year fraction and adjoint.
+             */
+            void add_dfs_adj(const std::vector<std::tuple<double, double>>& dfs_adj);
+
+            /**
+             * @brief Get the frozen zero rate curve.
+             *
+             * @return std::shared_ptr<const fin_curves::myZeroRate> Zero rate curve.
+             */
+            std::shared_ptr<const fin_curves::myZeroRate> get_crv() const {return this->crv;};
+    };
+}
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <filesystem>
+#include <algorithm>
+#include <cctype>
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_bootstrap.h"
+#include "fin_batch.h"
+
+// generate myBatch object
+fin_curves::myBatch::myBatch(const std::string& path, const std::string& crv_nm, const std::string& sep, const bool& quotes)
+{
+    // store variables into the object
+    this->path = path;
+    this->crv_nm = crv_nm;
+    this->sep = sep;
+    this->quotes = quotes;
+}
+
+// find dates of quote files within a date range
+std::vector<std::string> fin_curves::myBatch::find_dates(const std::string& date_from, const std::string& date_to, const std::string& date_format) const
+{
+    // convert dates to yyyymmdd so that they could be compared as strings
+    std::string date_from_str = lib_date::myDate(date_from, date_format).get_date_str();
+    std::string date_to_str = lib_date::myDate(date_to, date_format).get_date_str();
+
+    // quote files are named after curve and date, e.g. "eur_ri_ester_20220429.csv"
+    std::string prefix = this->crv_nm + "_";
+    std::string suffix = ".csv";
+    std::vector<std::string> dates;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(this->path + "inputs/curves/"))
+    {
+        if (!entry.is_regular_file())
+            continue;
+
+        std::string file_nm = entry.path().filename().string();
+        if ((file_nm.size() != prefix.size() + 8 + suffix.size()) || (file_nm.compare(0, prefix.size(), prefix) != 0) || (file_nm.compare(file_nm.size() - suffix.size(), suffix.size(), suffix) != 0))
+            continue;
+
+        std::string date = file_nm.substr(prefix.size(), 8);
+        if (!std::all_of(date.begin(), date.end(), [](const char& c) {return std::isdigit(c);}))
+            continue;
+
+        if ((date.compare(date_from_str) >= 0) && (date.compare(date_to_str) <= 0))
+            dates.push_back(date);
+    }
+
+    // return sorted dates
+    std::sort(dates.begin(), dates.end());
+    return dates;
+}
+
+// bootstrap zero rate curve for all dates of a date range
+std::size_t fin_curves::myBatch::run(const std::string& date_from, const std::string& date_to, const std::size_t& threads_no, const std::string& date_format)
+{
+    // find dates to be processed
+    this->dates = this->find_dates(date_from, date_to, date_format);
+    this->errs.assign(this->dates.size(), "");
+    if (this->dates.size() == 0)
+        return 0;
+
+    // number of worker threads
+    std::size_t workers_no = (threads_no > 0) ? threads_no : std::max(1u, std::thread::hardware_concurrency());
+    workers_no = std::min(workers_no, this->dates.size());
+
+    // workers take dates one by one from a shared index, so a thread finishing its dates early takes over the remaining ones and dates of different
+    // costs do not leave threads idle; dates are taken in ascending order, so calendars cached by a thread mostly cover the same years. Each date writes
+    // only its own output file and its own error message
+    std::atomic<std::size_t> idx_next = 0;
+    auto worker = [&]()
+    {
+        std::shared_ptr<fin_curves::myBootstrap> bootstrap;
+        std::shared_ptr<fin_curves::myZeroRate> dsc_crv;
+        std::string err;
+        try
+        {
+            bootstrap = std::make_shared<fin_curves::myBootstrap>(this->path, this->crv_nm, this->sep, this->quotes);
+            if (this->dsc_crv_nm.size() > 0)
+            {
+                dsc_crv = std::make_shared<fin_curves::myZeroRate>(this->path, this->dsc_crv_nm, this->sep, this->quotes);
+                bootstrap->set_dsc_crv(dsc_crv);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            err = e.what();
+        }
+
+        for (std::size_t idx = idx_next++; idx < this->dates.size(); idx = idx_next++)
+        {
+            if (err.size() > 0)
+            {
+                this->errs[idx] = err;
+                continue;
+            }
+
+            try
+            {
+                if (dsc_crv != nullptr)
+                    dsc_crv->load(this->dates[idx], "yyyymmdd", this->sep, this->quotes);
+                bootstrap->load(this->dates[idx]);
+                bootstrap->run();
+                bootstrap->save(this->sep, this->suffix);
+            }
+            catch (const std::exception& e)
+            {
+                this->errs[idx] = e.what();
+            }
+        }
+    };
+
+    // run worker threads
+    std::vector<std::thread> workers;
+    for (std::size_t worker_idx = 0; worker_idx < workers_no; worker_idx++)
+        workers.push_back(std::thread(worker));
+    for (std::thread& thread : workers)
+        thread.join();
+
+    // return number of successfully bootstrapped dates
+    return std::count(this->errs.begin(), this->errs.end(), "");
+}
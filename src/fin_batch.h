@@ -0,0 +1,101 @@
+/** \example fin_batch_examples.h
+ * @file fin_batch.h
+ * @author Michal Mackanic
+ * @brief Bootstrap historical zero rate curves for a range of dates in parallel.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+namespace fin_curves
+{
+    /**
+     * @brief Object bootstrapping zero rate curve for all dates of a date range with available quote files. Dates are independent, so worker threads take
+     * them one by one from a shared index until all dates are processed. Each thread keeps its own bootstrap object, so generators and calendars are cached
+     * per thread; coupon schedules are cached per thread by date, so they are generated once for each date a thread processes. Each date writes its own
+     * output file, so threads share only the index.
+     *
+     */
+    class myBatch
+    {
+        private:
+            std::string path;
+            std::string crv_nm;
+            std::string dsc_crv_nm = "";
+            std::string suffix = "";
+            std::string sep;
+            bool quotes;
+            std::vector<std::string> dates;
+            std::vector<std::string> errs;
+
+        public:
+            /**
+             * @brief Construct a new myBatch object.
+             *
+             * @param path Path to data folder; curve definition and quote files are expected in its "inputs/curves/" subfolder.
+             * @param crv_nm Curve name that corresponds to .csv file name with curve interpolation definition.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            myBatch(const std::string& path, const std::string& crv_nm, const std::string& sep = ",", const bool& quotes = false);
+
+            /**
+             * @brief Set name of zero rate curve used to discount cash flows of swap instruments; zero rates of the discount curve as of each date are loaded
+             * from "outputs/curves/" subfolder of the data folder, i.e. the discount curve has to be bootstrapped beforehand.
+             *
+             * @param dsc_crv_nm Discount curve name; "" => cash flows are discounted by the curve being bootstrapped.
+             */
+            void set_dsc_crv_nm(const std::string& dsc_crv_nm) {this->dsc_crv_nm = dsc_crv_nm;};
+
+            /**
+             * @brief Set suffix of names of the saved curve files, e.g. "_pokus" not to overwrite curves saved by a production run; discount curve is still
+             * loaded from files without suffix.
+             *
+             * @param suffix Suffix of the file names; "" => no suffix.
+             */
+            void set_suffix(const std::string& suffix) {this->suffix = suffix;};
+
+            /**
+             * @brief Find dates of quote files of the curve, e.g. "eur_ri_ester_20220429.csv", within a date range.
+             *
+             * @param date_from The first date of the range.
+             * @param date_to The last date of the range.
+             * @param date_format Format of the dates.
+             * @return std::vector<std::string> Sorted vector of dates in yyyymmdd format.
+             */
+            std::vector<std::string> find_dates(const std::string& date_from, const std::string& date_to, const std::string& date_format = "yyyymmdd") const;
+
+            /**
+             * @brief Bootstrap zero rate curve for all dates of a date range with available quote files and save zero rates into "outputs/curves/" subfolder
+             * of the data folder. Failure of a date does not stop the other dates; its error message is available through get_errs().
+             *
+             * @param date_from The first date of the range.
+             * @param date_to The last date of the range.
+             * @param threads_no Number of worker threads; 0 => number of hardware threads.
+             * @param date_format Format of the dates.
+             * @return std::size_t Number of successfully bootstrapped dates.
+             */
+            std::size_t run(const std::string& date_from, const std::string& date_to, const std::size_t& threads_no = 0, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Get dates processed by the last run.
+             *
+             * @return std::vector<std::string> Dates in yyyymmdd format.
+             */
+            std::vector<std::string> get_dates() const {return this->dates;};
+
+            /**
+             * @brief Get error messages of dates processed by the last run.
+             *
+             * @return std::vector<std::string> Error messages; "" => date was bootstrapped successfully.
+             */
+            std::vector<std::string> get_errs() const {return this->errs;};
+    };
+}
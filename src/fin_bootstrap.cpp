@@ -0,0 +1,822 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include "lib_math.h"
+#include "lib_dual.h"
+#include "lib_tape.h"
+#include "lib_tbl.h"
+#include "fin_date.h"
+#include "fin_curves.h"
+#include "fin_depoinstr.h"
+#include "fin_frainstr.h"
+#include "fin_oisinstr.h"
+#include "fin_irsinstr.h"
+#include "fin_fxswpinstr.h"
+#include "fin_bsswpinstr.h"
+#include "fin_calibration.h"
+#include "fin_bootstrap.h"
+
+// generate myBootstrap object using curve definition stored in a .csv file
+fin_curves::myBootstrap::myBootstrap(const std::string& path, const std::string& crv_nm, const std::string& sep, const bool& quotes)
+{
+    // store variables into the object
+    this->path = path;
+    this->crv_nm = crv_nm;
+    this->sep = sep;
+    this->quotes = quotes;
+
+    // create zero rate curve to be bootstrapped
+    this->crv = std::make_shared<fin_curves::myZeroRate>(path, crv_nm, sep, quotes);
+}
+
+// generate myBootstrap object using provided curve interpolation definition
+fin_curves::myBootstrap::myBootstrap(const std::string& path, const std::string& crv_nm, const fin_curves::zr_interp_def& interp_def, const std::string& sep, const bool& quotes)
+{
+    // store variables into the object
+    this->path = path;
+    this->crv_nm = crv_nm;
+    this->sep = sep;
+    this->quotes = quotes;
+
+    // create zero rate curve to be bootstrapped
+    this->crv = std::make_shared<fin_curves::myZeroRate>(crv_nm, interp_def, path);
+}
+
+// load market quotes from a quote file
+void fin_curves::myBootstrap::load(const std::string& date, const std::string& date_format)
+{
+    // convert date to yyyymmdd if necessary
+    std::string date_str = date;
+    if (date_format.compare("yyyymmdd") != 0)
+    {
+        lib_date::myDate date_aux(date, date_format);
+        date_str = date_aux.get_date_str();
+    }
+
+    // read quote file
+    lib_tbl::myTable quotes_tbl;
+    quotes_tbl.read(this->path + "inputs/curves/" + this->crv_nm + "_" + date_str + ".csv", this->sep, this->quotes);
+
+    // extract tenors, generators and quotes; missing quotes are represented by a null pointer
+    std::vector<std::string> tenors;
+    for (std::shared_ptr<std::string> tenor : quotes_tbl.get_str_column("tenor"))
+        tenors.push_back(*tenor);
+
+    std::vector<std::string> generator_nms;
+    for (std::shared_ptr<std::string> generator_nm : quotes_tbl.get_str_column("generator"))
+        generator_nms.push_back(*generator_nm);
+
+    std::vector<std::shared_ptr<double>> quotes = quotes_tbl.get_double_column("quote");
+
+    // load quotes into the object
+    this->load(date_str, tenors, generator_nms, quotes);
+}
+
+// load market quotes stored in vectors
+void fin_curves::myBootstrap::load(const std::string& date, const std::vector<std::string>& tenors, const std::vector<std::string>& generator_nms, const std::vector<std::shared_ptr<double>>& quotes, const std::string& date_format)
+{
+    // check that the vectors are of the same length
+    if ((tenors.size() != generator_nms.size()) || (tenors.size() != quotes.size()))
+        throw std::runtime_error((std::string)__func__ + ": Vectors of tenors, generators and quotes are of different length!");
+
+    // store date into the object and into the underlying zero rate curve
+    this->crv->set_date(date, date_format);
+    this->date = this->crv->get_date();
+
+    // create pillars; tenors are normalized, e.g. "1Y3M" => "15M", so that they could be used for date generation
+    std::vector<fin_curves::pillar> pillars_aux;
+    std::vector<double> maturities;
+    for (std::size_t idx = 0; idx < tenors.size(); idx++)
+    {
+        std::tuple<int, std::string> freq_decomposed = fin_date::decompose_freq(tenors[idx]);
+
+        fin_curves::pillar pillar;
+        pillar.tenor = fin_date::compose_freq(freq_decomposed);
+        pillar.generator = generator_nms[idx];
+        pillar.quote = quotes[idx];
+        pillar.maturity = fin_date::get_tenor_maturity(freq_decomposed);
+        pillars_aux.push_back(pillar);
+        maturities.push_back(pillar.maturity);
+    }
+
+    // sort pillars by maturity
+    this->pillars.clear();
+    for (std::size_t idx : lib_math::sort_index(maturities))
+        this->pillars.push_back(pillars_aux[idx]);
+
+    // interpolate missing quotes
+    this->interp_quotes();
+
+    // calibration equations of the previous date cannot be updated anymore
+    this->calib_eqs.clear();
+
+    // load generators used by the pillars; generators loaded for the previous date are reused if the pillars did not change
+    std::vector<std::string> generator_nms_unique;
+    for (fin_curves::pillar pillar : this->pillars)
+    {
+        if (std::find(generator_nms_unique.begin(), generator_nms_unique.end(), pillar.generator) == generator_nms_unique.end())
+            generator_nms_unique.push_back(pillar.generator);
+    }
+    if ((this->generators == nullptr) || (generator_nms_unique != this->generator_nms))
+    {
+        this->generators = std::make_shared<fin_curves::myGenerators>(generator_nms_unique, this->path, this->sep, this->quotes);
+        this->generator_nms = generator_nms_unique;
+    }
+}
+
+// interpolate missing quotes using quotes of the same generator
+void fin_curves::myBootstrap::interp_quotes()
+{
+    // go generator by generator
+    std::vector<std::string> generator_nms_done;
+    for (fin_curves::pillar pillar : this->pillars)
+    {
+        // skip generators, which were already processed
+        if (std::find(generator_nms_done.begin(), generator_nms_done.end(), pillar.generator) != generator_nms_done.end())
+            continue;
+        generator_nms_done.push_back(pillar.generator);
+
+        // collect pillars of the generator
+        std::vector<std::size_t> idxs;
+        std::vector<std::shared_ptr<double>> maturities;
+        std::vector<std::shared_ptr<double>> quotes;
+        bool is_missing = false;
+        for (std::size_t idx = 0; idx < this->pillars.size(); idx++)
+        {
+            if (this->pillars[idx].generator.compare(pillar.generator) == 0)
+            {
+                idxs.push_back(idx);
+                maturities.push_back(std::make_shared<double>(this->pillars[idx].maturity));
+                quotes.push_back(this->pillars[idx].quote);
+                if (this->pillars[idx].quote == nullptr)
+                    is_missing = true;
+            }
+        }
+
+        // interpolate missing quotes
+        if (is_missing)
+        {
+            std::vector<double> quotes_interp = std::get<1>(fin_curves::interp_rate(maturities, quotes));
+            for (std::size_t idx = 0; idx < idxs.size(); idx++)
+                this->pillars[idxs[idx]].quote = std::make_shared<double>(quotes_interp[idx]);
+        }
+    }
+}
+
+// check whether curve nodes are solved one by one
+bool fin_curves::myBootstrap::is_sequential() const
+{
+    // cubic spline moves zero rates of all nodes and monotone convex forwards of a segment depend on the following node, so they are calibrated at once
+    std::string zr_interp = this->crv->get_def().zr_interp;
+    if ((zr_interp.compare("linear") == 0) || (zr_interp.compare("log_linear") == 0))
+        return true;
+    else if ((zr_interp.compare("cubic") == 0) || (zr_interp.compare("monotone_convex") == 0))
+        return false;
+    else
+        throw std::runtime_error((std::string)__func__ + ": Bootstrap of curve '" + this->crv_nm + "' does not support '" + zr_interp + "' interpolation!");
+}
+
+// bootstrap zero rate curve
+void fin_curves::myBootstrap::run()
+{
+    // nodes of interpolations not solvable one by one are calibrated at once starting from the sequential bootstrap
+    this->set_nodes(nullptr);
+    if (!this->is_sequential())
+        this->solve_global(nullptr);
+}
+
+// place curve nodes and collect calibration equations of the pillars
+void fin_curves::myBootstrap::set_nodes(const std::shared_ptr<fin_curves::myZeroRate>& crv_init)
+{
+    // check that quotes were loaded
+    if (this->pillars.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": No quotes were loaded for curve '" + this->crv_nm + "'!");
+
+    // nodes are solved one by one, i.e. a node does not move zero rates of the nodes preceding it; zero rates are only initial ones for interpolations
+    // calibrated at once
+    this->is_sequential();
+
+    // clear previously bootstrapped zero rates, calibration equations and node dependencies
+    this->crv->reset();
+    this->calib_eqs.clear();
+    this->nodes_deps.clear();
+    this->fx_idxs.clear();
+
+    // clear previously bootstrapped FX forwards; FX spot rate is kept
+    if (this->fx_crv != nullptr)
+    {
+        this->fx_crv->set_spot(this->fx_crv->get_spot());
+        this->fx_crv->set_date(this->date);
+    }
+
+    // swap strips caching coupon schedules, forwards and present values between consecutive swaps of the same generator; strips are kept after the
+    // bootstrap, so that their schedules could be reused when a quote is updated
+    this->irs_strips.clear();
+    this->bs_strips.clear();
+
+    // evaluate pillar by pillar; each instrument adds its maturity year fraction and zero rate to the curve
+    for (fin_curves::pillar pillar : this->pillars)
+    {
+        std::shared_ptr<fin_curves::generator> generator = this->generators->get(pillar.generator);
+
+        if (generator->instr_tp.compare("depo") == 0)
+        {
+            fin_curves::myDepoInstr depo = fin_curves::myDepoInstr(this->date, pillar.tenor, *pillar.quote, generator, *this->crv);
+            this->calib_eqs.push_back(depo.get_calib_eq());
+            this->fx_idxs.push_back(0);
+        }
+        else if (generator->instr_tp.compare("fra") == 0)
+        {
+            fin_curves::myFraInstr fra = fin_curves::myFraInstr(this->date, pillar.tenor, *pillar.quote, generator, *this->crv);
+            this->crv->add(fra.get_yr_frac_zr());
+            this->calib_eqs.push_back(fra.get_calib_eq());
+            this->fx_idxs.push_back(0);
+        }
+        else if (generator->instr_tp.compare("ois") == 0)
+        {
+            fin_curves::myOisInstr ois = fin_curves::myOisInstr(this->date, pillar.tenor, *pillar.quote, generator, *this->crv);
+            this->crv->add(ois.get_yr_frac_zr());
+            this->calib_eqs.push_back(ois.get_calib_eq());
+            this->fx_idxs.push_back(0);
+        }
+        else if (generator->instr_tp.compare("irswp") == 0)
+        {
+            if (this->irs_strips.find(pillar.generator) == this->irs_strips.end())
+                this->irs_strips[pillar.generator] = std::make_shared<fin_curves::myIrsInstr>(this->date, generator, *this->crv, this->dsc_crv);
+            if (crv_init == nullptr)
+            {
+                this->crv->add(this->irs_strips[pillar.generator]->solve(pillar.tenor, *pillar.quote, *this->crv));
+                this->calib_eqs.push_back(this->irs_strips[pillar.generator]->get_calib_eq());
+            }
+            else
+            {
+                double yr_frac = this->irs_strips[pillar.generator]->get_yr_frac_node(pillar.tenor);
+                this->crv->add({yr_frac, crv_init->get_zr(yr_frac)});
+                this->calib_eqs.push_back(this->irs_strips[pillar.generator]->get_calib_eq(pillar.tenor, *pillar.quote));
+            }
+            this->fx_idxs.push_back(0);
+        }
+        else if (generator->instr_tp.compare("fxswp") == 0)
+        {
+            if ((this->fx_crv == nullptr) || (this->fx_oth_crv == nullptr))
+                throw std::runtime_error((std::string)__func__ + ": FX curve needed by generator '" + pillar.generator + "' is not set!");
+            fin_curves::myFxSwpInstr fxswp = fin_curves::myFxSwpInstr(this->date, pillar.tenor, *pillar.quote, generator, *this->fx_crv, *this->fx_oth_crv, *this->crv);
+            this->crv->add(fxswp.get_yr_frac_zr());
+            this->fx_idxs.push_back(this->fx_crv->get_size());
+            this->fx_crv->add(fxswp.get_yr_frac_fx());
+            this->calib_eqs.push_back(fxswp.get_calib_eq());
+        }
+        else if (generator->instr_tp.compare("bsswp") == 0)
+        {
+            if (this->bs_strips.find(pillar.generator) == this->bs_strips.end())
+                this->bs_strips[pillar.generator] = std::make_shared<fin_curves::myBsSwpInstr>(this->date, generator, *this->crv, this->dom_prj_crv, this->for_prj_crv, this->fx_oth_crv, this->fx_crv);
+            if (crv_init == nullptr)
+            {
+                this->crv->add(this->bs_strips[pillar.generator]->solve(pillar.tenor, *pillar.quote, *this->crv));
+                this->calib_eqs.push_back(this->bs_strips[pillar.generator]->get_calib_eq());
+            }
+            else
+            {
+                double yr_frac = this->bs_strips[pillar.generator]->get_yr_frac_node(pillar.tenor);
+                this->crv->add({yr_frac, crv_init->get_zr(yr_frac)});
+                this->calib_eqs.push_back(this->bs_strips[pillar.generator]->get_calib_eq(pillar.tenor, *pillar.quote));
+            }
+            if (this->fx_crv != nullptr)
+            {
+                this->fx_idxs.push_back(this->fx_crv->get_size());
+                if (crv_init == nullptr)
+                    this->fx_crv->add(this->bs_strips[pillar.generator]->get_yr_frac_fx());
+                else
+                    this->fx_crv->add(this->bs_strips[pillar.generator]->get_yr_frac_fx(pillar.tenor, *this->crv));
+            }
+            else
+                this->fx_idxs.push_back(0);
+        }
+        else
+            throw std::runtime_error((std::string)__func__ + ": Instrument type '" + generator->instr_tp + "' of generator '" + pillar.generator + "' is not supported!");
+    }
+
+    // instruments solve their nodes under linearly interpolated zero rates; nodes of log-linear discount factors are re-solved one by one starting
+    // from them
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    fin_curves::zr_interp_def interp_def = this->crv->get_def();
+    if ((crv_init == nullptr) && (interp_def.zr_interp.compare("log_linear") == 0))
+    {
+        std::vector<double> zrs;
+        for (std::size_t idx = 0; idx < yr_fracs.size(); idx++)
+            zrs.push_back(this->crv->get_zr(idx));
+        for (std::size_t idx = 0; idx < yr_fracs.size(); idx++)
+            zrs[idx] = fin_curves::myCalibration::solve_node(yr_fracs, zrs, idx, interp_def.zr_type, interp_def.zr_interp, this->calib_eqs[idx]);
+        this->load_zrs(zrs);
+    }
+
+    // record preceding curve nodes each curve node depends on
+    for (std::size_t idx = 0; idx < yr_fracs.size(); idx++)
+        this->nodes_deps.push_back(this->find_node_deps(yr_fracs, idx));
+}
+
+// find preceding curve nodes a curve node depends on
+std::vector<std::size_t> fin_curves::myBootstrap::find_node_deps(const std::vector<double>& yr_fracs, const std::size_t& idx) const
+{
+    // discount factors as of year fractions following the node depend only on the node itself, discount factors between two preceding nodes depend on both
+    // of them
+    std::vector<std::size_t> deps;
+    auto add_dep = [&](const double& yr_frac)
+    {
+        if ((yr_frac <= 0.0) || (idx == 0) || (yr_frac >= yr_fracs[idx]))
+            return;
+
+        std::size_t idx_hi = std::upper_bound(yr_fracs.begin(), yr_fracs.begin() + idx + 1, yr_frac) - yr_fracs.begin();
+        if (idx_hi == 0)
+        {
+            deps.push_back(0);
+            return;
+        }
+        deps.push_back(idx_hi - 1);
+        if ((idx_hi < idx) && (yr_frac > yr_fracs[idx_hi - 1]))
+            deps.push_back(idx_hi);
+    };
+
+    const fin_curves::calib_eq& eq = this->calib_eqs[idx];
+    for (const auto& [weight, yr_frac] : eq.dfs)
+        add_dep(yr_frac);
+    for (const auto& [weight, yr_frac_num, yr_frac_den] : eq.df_ratios)
+    {
+        add_dep(yr_frac_num);
+        add_dep(yr_frac_den);
+    }
+
+    // remove duplicates
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+    return deps;
+}
+
+// update quote of a single pillar and re-solve affected curve nodes
+std::size_t fin_curves::myBootstrap::update(const std::size_t& idx, const double& quote)
+{
+    // check that the curve was bootstrapped with the current pillars
+    std::size_t nodes_no = this->pillars.size();
+    if (idx >= nodes_no)
+        throw std::runtime_error((std::string)__func__ + ": Pillar " + std::to_string(idx) + " of curve '" + this->crv_nm + "' does not exist!");
+    if ((this->calib_eqs.size() != nodes_no) || (this->crv->get_size() != nodes_no))
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nm + "' has to be bootstrapped before its quotes are updated!");
+    fin_curves::zr_interp_def interp_def = this->crv->get_def();
+    bool is_sequential = this->is_sequential();
+
+    // update quote of the pillar
+    this->pillars[idx].quote = std::make_shared<double>(quote);
+
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    std::vector<double> zrs;
+    for (std::size_t node_idx = 0; node_idx < nodes_no; node_idx++)
+        zrs.push_back(this->crv->get_zr(node_idx));
+
+    std::vector<double> yr_fracs_fx;
+    std::vector<double> fxs;
+    if (this->fx_crv != nullptr)
+    {
+        yr_fracs_fx = this->fx_crv->get_yr_fracs();
+        for (std::size_t node_idx = 0; node_idx < yr_fracs_fx.size(); node_idx++)
+            fxs.push_back(this->fx_crv->get_fx(node_idx));
+    }
+
+    // rebuild calibration equation of the pillar
+    this->set_calib_eq(idx, yr_fracs, zrs, fxs);
+
+    // re-solve the node of the pillar and the following nodes depending on any re-solved node; nodes are solved in the order of their maturity as in
+    // sequential bootstrap
+    std::vector<bool> is_affected(nodes_no, false);
+    std::size_t solved_no = 0;
+    for (std::size_t node_idx = idx; is_sequential && (node_idx < nodes_no); node_idx++)
+    {
+        if (node_idx > idx)
+        {
+            for (std::size_t dep : this->nodes_deps[node_idx])
+                is_affected[node_idx] = is_affected[node_idx] || is_affected[dep];
+        }
+        else
+            is_affected[node_idx] = true;
+
+        if (!is_affected[node_idx])
+            continue;
+
+        zrs[node_idx] = fin_curves::myCalibration::solve_node(yr_fracs, zrs, node_idx, interp_def.zr_type, interp_def.zr_interp, this->calib_eqs[node_idx]);
+        solved_no++;
+    }
+
+    // nodes calibrated at once are all re-solved starting from their current zero rates
+    if (!is_sequential)
+    {
+        fin_curves::myCalibration calibration = fin_curves::myCalibration(*this->crv, this->calib_eqs);
+        zrs = calibration.solve(zrs);
+        this->calib_iters_no = calibration.get_iters_no();
+        is_affected.assign(nodes_no, true);
+        solved_no = nodes_no;
+    }
+    this->crv->load(this->date, yr_fracs, zrs);
+
+    // FX forwards implied by re-solved cross-currency basis swaps
+    if (this->fx_crv != nullptr)
+    {
+        this->set_bs_fxs(fxs, is_affected);
+        this->fx_crv->load(this->date, yr_fracs_fx, fxs);
+    }
+
+    return solved_no;
+}
+
+// rebuild calibration equation of a pillar
+void fin_curves::myBootstrap::set_calib_eq(const std::size_t& idx, const std::vector<double>& yr_fracs, const std::vector<double>& zrs, std::vector<double>& fxs)
+{
+    // instruments are evaluated against curve nodes preceding the pillar, swap strips reuse their schedules
+    const fin_curves::pillar& pillar = this->pillars[idx];
+    std::shared_ptr<fin_curves::generator> generator = this->generators->get(pillar.generator);
+    fin_curves::myZeroRate crv_known = *this->crv;
+    crv_known.load(this->date, std::vector<double>(yr_fracs.begin(), yr_fracs.begin() + idx), std::vector<double>(zrs.begin(), zrs.begin() + idx));
+    if (generator->instr_tp.compare("depo") == 0)
+        this->calib_eqs[idx] = fin_curves::myDepoInstr(this->date, pillar.tenor, *pillar.quote, generator, crv_known).get_calib_eq();
+    else if (generator->instr_tp.compare("fra") == 0)
+        this->calib_eqs[idx] = fin_curves::myFraInstr(this->date, pillar.tenor, *pillar.quote, generator, crv_known).get_calib_eq();
+    else if (generator->instr_tp.compare("ois") == 0)
+        this->calib_eqs[idx] = fin_curves::myOisInstr(this->date, pillar.tenor, *pillar.quote, generator, crv_known).get_calib_eq();
+    else if (generator->instr_tp.compare("irswp") == 0)
+        this->calib_eqs[idx] = this->irs_strips.at(pillar.generator)->get_calib_eq(pillar.tenor, *pillar.quote);
+    else if (generator->instr_tp.compare("fxswp") == 0)
+    {
+        fin_curves::myFxSwpInstr fxswp = fin_curves::myFxSwpInstr(this->date, pillar.tenor, *pillar.quote, generator, *this->fx_crv, *this->fx_oth_crv, crv_known);
+        this->calib_eqs[idx] = fxswp.get_calib_eq();
+        fxs[this->fx_idxs[idx]] = std::get<1>(fxswp.get_yr_frac_fx());
+    }
+    else if (generator->instr_tp.compare("bsswp") == 0)
+        this->calib_eqs[idx] = this->bs_strips.at(pillar.generator)->get_calib_eq(pillar.tenor, *pillar.quote);
+    else
+        throw std::runtime_error((std::string)__func__ + ": Instrument type '" + generator->instr_tp + "' of generator '" + pillar.generator + "' is not supported!");
+}
+
+// re-solve curve nodes after input curves changed
+std::size_t fin_curves::myBootstrap::refresh(const double& yr_frac)
+{
+    // check that the curve was bootstrapped with the current pillars
+    std::size_t nodes_no = this->pillars.size();
+    if ((this->calib_eqs.size() != nodes_no) || (this->crv->get_size() != nodes_no))
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nm + "' has to be bootstrapped before it is refreshed!");
+    fin_curves::zr_interp_def interp_def = this->crv->get_def();
+    bool is_sequential = this->is_sequential();
+
+    // pillars maturing up to the year fraction keep their calibration equations and, if solved one by one, their nodes
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    std::size_t idx_from = std::upper_bound(yr_fracs.begin(), yr_fracs.end(), yr_frac) - yr_fracs.begin();
+    if (idx_from == nodes_no)
+        return 0;
+
+    std::vector<double> zrs;
+    for (std::size_t node_idx = 0; node_idx < nodes_no; node_idx++)
+        zrs.push_back(this->crv->get_zr(node_idx));
+
+    std::vector<double> yr_fracs_fx;
+    std::vector<double> fxs;
+    if (this->fx_crv != nullptr)
+    {
+        yr_fracs_fx = this->fx_crv->get_yr_fracs();
+        for (std::size_t node_idx = 0; node_idx < yr_fracs_fx.size(); node_idx++)
+            fxs.push_back(this->fx_crv->get_fx(node_idx));
+    }
+
+    // swap strips cache discount factors and forwards of the input curves and they are shared with saved states, so strips of the following pillars are
+    // replaced by new ones rather than cleared
+    std::vector<std::string> strips_new;
+    for (std::size_t node_idx = idx_from; node_idx < nodes_no; node_idx++)
+    {
+        const std::string& generator_nm = this->pillars[node_idx].generator;
+        if (std::find(strips_new.begin(), strips_new.end(), generator_nm) != strips_new.end())
+            continue;
+
+        std::shared_ptr<fin_curves::generator> generator = this->generators->get(generator_nm);
+        if (generator->instr_tp.compare("irswp") == 0)
+            this->irs_strips[generator_nm] = std::make_shared<fin_curves::myIrsInstr>(this->date, generator, *this->crv, this->dsc_crv);
+        else if (generator->instr_tp.compare("bsswp") == 0)
+            this->bs_strips[generator_nm] = std::make_shared<fin_curves::myBsSwpInstr>(this->date, generator, *this->crv, this->dom_prj_crv, this->for_prj_crv, this->fx_oth_crv, this->fx_crv);
+        strips_new.push_back(generator_nm);
+    }
+
+    // rebuild calibration equations of the pillars referencing input curves; equations of the other instruments reference only the curve itself. Nodes
+    // of changed equations and the following nodes depending on any re-solved node are re-solved in the order of their maturity as in sequential
+    // bootstrap, i.e. input curves changed only around their bumped nodes leave most nodes untouched
+    std::vector<bool> is_affected(nodes_no, false);
+    std::size_t solved_no = 0;
+    for (std::size_t node_idx = idx_from; node_idx < nodes_no; node_idx++)
+    {
+        std::string instr_tp = this->generators->get(this->pillars[node_idx].generator)->instr_tp;
+        if ((instr_tp.compare("irswp") == 0) || (instr_tp.compare("fxswp") == 0) || (instr_tp.compare("bsswp") == 0))
+        {
+            fin_curves::calib_eq eq = this->calib_eqs[node_idx];
+            this->set_calib_eq(node_idx, yr_fracs, zrs, fxs);
+            const fin_curves::calib_eq& eq_new = this->calib_eqs[node_idx];
+            is_affected[node_idx] = (eq.cst != eq_new.cst) || (eq.dfs != eq_new.dfs) || (eq.df_ratios != eq_new.df_ratios);
+        }
+        for (std::size_t dep : this->nodes_deps[node_idx])
+            is_affected[node_idx] = is_affected[node_idx] || is_affected[dep];
+
+        if (!is_sequential || !is_affected[node_idx])
+            continue;
+
+        zrs[node_idx] = fin_curves::myCalibration::solve_node(yr_fracs, zrs, node_idx, interp_def.zr_type, interp_def.zr_interp, this->calib_eqs[node_idx]);
+        solved_no++;
+    }
+
+    // nodes calibrated at once are all re-solved starting from their current zero rates
+    if (!is_sequential && (std::find(is_affected.begin(), is_affected.end(), true) != is_affected.end()))
+    {
+        fin_curves::myCalibration calibration = fin_curves::myCalibration(*this->crv, this->calib_eqs);
+        zrs = calibration.solve(zrs);
+        this->calib_iters_no = calibration.get_iters_no();
+        is_affected.assign(nodes_no, true);
+        solved_no = nodes_no;
+    }
+    this->crv->load(this->date, yr_fracs, zrs);
+
+    // FX forwards implied by re-solved cross-currency basis swaps
+    if (this->fx_crv != nullptr)
+    {
+        this->set_bs_fxs(fxs, is_affected);
+        this->fx_crv->load(this->date, yr_fracs_fx, fxs);
+    }
+
+    return solved_no;
+}
+
+// get year fraction up to which discount factors did not change
+double fin_curves::myBootstrap::get_yr_frac_same(const fin_curves::bootstrap_state& state) const
+{
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    if (yr_fracs != state.yr_fracs)
+        return 0.0;
+
+    std::size_t idx = 0;
+    while ((idx < yr_fracs.size()) && (this->crv->get_zr(idx) == state.zrs[idx]))
+        idx++;
+    if (idx == yr_fracs.size())
+        return std::numeric_limits<double>::infinity();
+
+    // node of linearly interpolated zero rates or log-linear discount factors moves only the segments next to it; other interpolations move whole curve
+    if ((idx == 0) || !this->is_sequential())
+        return 0.0;
+    return yr_fracs[idx - 1];
+}
+
+// re-evaluate FX forwards implied by cross-currency basis swaps of re-solved nodes
+void fin_curves::myBootstrap::set_bs_fxs(std::vector<double>& fxs, const std::vector<bool>& is_affected) const
+{
+    for (std::size_t node_idx = 0; node_idx < is_affected.size(); node_idx++)
+    {
+        if (!is_affected[node_idx] || (this->fx_idxs[node_idx] == 0))
+            continue;
+
+        const fin_curves::pillar& pillar_affected = this->pillars[node_idx];
+        if (this->generators->get(pillar_affected.generator)->instr_tp.compare("bsswp") == 0)
+            fxs[this->fx_idxs[node_idx]] = std::get<1>(this->bs_strips.at(pillar_affected.generator)->get_yr_frac_fx(pillar_affected.tenor, *this->crv));
+    }
+}
+
+// update quote of a single pillar identified by its tenor and generator
+std::size_t fin_curves::myBootstrap::update(const std::string& tenor, const std::string& generator_nm, const double& quote)
+{
+    std::string tenor_norm = fin_date::compose_freq(fin_date::decompose_freq(tenor));
+    for (std::size_t idx = 0; idx < this->pillars.size(); idx++)
+    {
+        if ((this->pillars[idx].tenor.compare(tenor_norm) == 0) && (this->pillars[idx].generator.compare(generator_nm) == 0))
+            return this->update(idx, quote);
+    }
+
+    throw std::runtime_error((std::string)__func__ + ": Pillar '" + tenor + "' of generator '" + generator_nm + "' does not exist in curve '" + this->crv_nm + "'!");
+}
+
+// get state of the bootstrapped curve
+fin_curves::bootstrap_state fin_curves::myBootstrap::get_state() const
+{
+    fin_curves::bootstrap_state state;
+    state.pillars = this->pillars;
+    state.irs_strips = this->irs_strips;
+    state.bs_strips = this->bs_strips;
+    state.calib_eqs = this->calib_eqs;
+    state.nodes_deps = this->nodes_deps;
+    state.fx_idxs = this->fx_idxs;
+    state.calib_iters_no = this->calib_iters_no;
+    state.yr_fracs = this->crv->get_yr_fracs();
+    for (std::size_t idx = 0; idx < state.yr_fracs.size(); idx++)
+        state.zrs.push_back(this->crv->get_zr(idx));
+    if (this->fx_crv != nullptr)
+    {
+        state.yr_fracs_fx = this->fx_crv->get_yr_fracs();
+        for (std::size_t idx = 0; idx < state.yr_fracs_fx.size(); idx++)
+            state.fxs.push_back(this->fx_crv->get_fx(idx));
+    }
+    return state;
+}
+
+// restore state of the curve
+void fin_curves::myBootstrap::set_state(const fin_curves::bootstrap_state& state)
+{
+    // swap strips of the state cache discount factors of the input curves the state was bootstrapped with
+    this->pillars = state.pillars;
+    this->irs_strips = state.irs_strips;
+    this->bs_strips = state.bs_strips;
+    this->calib_eqs = state.calib_eqs;
+    this->nodes_deps = state.nodes_deps;
+    this->fx_idxs = state.fx_idxs;
+    this->calib_iters_no = state.calib_iters_no;
+
+    // nodes are loaded into the existing curves, i.e. curves sharing them are restored as well
+    this->crv->load(this->date, state.yr_fracs, state.zrs);
+    if (this->fx_crv != nullptr)
+        this->fx_crv->load(this->date, state.yr_fracs_fx, state.fxs);
+}
+
+// calibrate all curve nodes simultaneously
+void fin_curves::myBootstrap::run_global(const std::shared_ptr<fin_curves::myZeroRate>& crv_init)
+{
+    // curve nodes are placed and calibration equations of the pillars collected either by sequential bootstrap or, given an initial curve, without
+    // solving the swaps
+    this->set_nodes(crv_init);
+    this->solve_global(crv_init);
+}
+
+// solve zero rates of all curve nodes at once
+void fin_curves::myBootstrap::solve_global(const std::shared_ptr<fin_curves::myZeroRate>& crv_init)
+{
+    // initial zero rates are taken either from the sequential bootstrap or from the provided curve, e.g. curve of the previous business day
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    std::vector<double> zrs_init;
+    for (std::size_t idx = 0; idx < yr_fracs.size(); idx++)
+        zrs_init.push_back((crv_init == nullptr) ? this->crv->get_zr(idx) : crv_init->get_zr(yr_fracs[idx]));
+
+    // solve all nodes at once using interpolation of the curve
+    fin_curves::myCalibration calibration = fin_curves::myCalibration(*this->crv, this->calib_eqs);
+    std::vector<double> zrs = calibration.solve(zrs_init);
+    this->calib_iters_no = calibration.get_iters_no();
+
+    // replace bootstrapped zero rates by calibrated ones
+    this->load_zrs(zrs);
+}
+
+// replace zero rates of all curve nodes
+void fin_curves::myBootstrap::load_zrs(const std::vector<double>& zrs)
+{
+    this->crv->load(this->date, this->crv->get_yr_fracs(), zrs);
+
+    // FX forwards implied by cross-currency basis swaps follow the new zero rates
+    if (this->fx_crv != nullptr)
+    {
+        std::vector<double> yr_fracs_fx = this->fx_crv->get_yr_fracs();
+        std::vector<double> fxs;
+        for (std::size_t idx = 0; idx < yr_fracs_fx.size(); idx++)
+            fxs.push_back(this->fx_crv->get_fx(idx));
+        this->set_bs_fxs(fxs, std::vector<bool>(zrs.size(), true));
+        this->fx_crv->load(this->date, yr_fracs_fx, fxs);
+    }
+}
+
+// get the largest residual of calibration equations
+double fin_curves::myBootstrap::get_residual_max() const
+{
+    // check that the curve was bootstrapped with the current pillars
+    std::size_t nodes_no = this->pillars.size();
+    if ((this->calib_eqs.size() != nodes_no) || (this->crv->get_size() != nodes_no))
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nm + "' has to be bootstrapped before its residuals are evaluated!");
+
+    std::vector<double> zrs;
+    for (std::size_t idx = 0; idx < nodes_no; idx++)
+        zrs.push_back(this->crv->get_zr(idx));
+    fin_curves::myCalibration calibration = fin_curves::myCalibration(*this->crv, this->calib_eqs);
+    double residual_max = 0.0;
+    for (double residual : calibration.get_residuals(zrs))
+        residual_max = std::max(residual_max, std::abs(residual));
+    return residual_max;
+}
+
+// save bootstrapped zero rates and FX forwards
+void fin_curves::myBootstrap::save(const std::string& sep, const std::string& suffix)
+{
+    this->crv->save_data(sep, suffix);
+    if (this->fx_crv != nullptr)
+        this->fx_crv->save_data(sep, suffix);
+}
+
+// get derivatives of node residuals with respect to own zero rates
+std::vector<double> fin_curves::myBootstrap::get_residual_derivs() const
+{
+    // check that the curve was bootstrapped with the current pillars
+    std::size_t nodes_no = this->pillars.size();
+    if ((this->calib_eqs.size() != nodes_no) || (this->crv->get_size() != nodes_no))
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nm + "' has to be bootstrapped before its sensitivities are evaluated!");
+    if (!this->is_sequential())
+        throw std::runtime_error((std::string)__func__ + ": Sensitivities of curve '" + this->crv_nm + "' are evaluated only for nodes solved one by one!");
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    fin_curves::zr_interp_def interp_def = this->crv->get_def();
+
+    std::vector<double> residual_derivs;
+    std::vector<lib_math::dual<1>> zrs_node;
+    for (std::size_t idx = 0; idx < nodes_no; idx++)
+        zrs_node.push_back(lib_math::dual<1>(this->crv->get_zr(idx)));
+    for (std::size_t idx = 0; idx < nodes_no; idx++)
+    {
+        zrs_node[idx].grad[0] = 1.0;
+        residual_derivs.push_back(fin_curves::myCalibration::eval_node_residual(yr_fracs, zrs_node, idx, interp_def.zr_type, interp_def.zr_interp, this->calib_eqs[idx], lib_math::dual<1>(0.0)).grad[0]);
+        zrs_node[idx].grad[0] = 0.0;
+    }
+
+    return residual_derivs;
+}
+
+// get Jacobian of node zero rates with respect to pillar quotes
+std::vector<std::vector<double>> fin_curves::myBootstrap::get_jacobian() const
+{
+    // derivative of residual of each node with respect to its own zero rate
+    std::vector<double> residual_derivs = this->get_residual_derivs();
+    std::size_t nodes_no = this->pillars.size();
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    std::vector<double> zrs;
+    for (std::size_t idx = 0; idx < nodes_no; idx++)
+        zrs.push_back(this->crv->get_zr(idx));
+    fin_curves::zr_interp_def interp_def = this->crv->get_def();
+
+    // gradients with respect to quotes are evaluated in chunks of lanes; nodes preceding the first quote of a chunk do not depend on the chunk
+    constexpr std::size_t lanes_no = 8;
+    std::vector<std::vector<double>> jacobian(nodes_no, std::vector<double>(nodes_no, 0.0));
+    for (std::size_t quote_first = 0; quote_first < nodes_no; quote_first += lanes_no)
+    {
+        std::vector<lib_math::dual<lanes_no>> zrs_quote(zrs.begin(), zrs.end());
+        for (std::size_t idx = quote_first; idx < nodes_no; idx++)
+        {
+            lib_math::dual<lanes_no> quote_chg = (idx < quote_first + lanes_no) ? lib_math::dual<lanes_no>::seed(0.0, idx - quote_first) : lib_math::dual<lanes_no>(0.0);
+            lib_math::dual<lanes_no> residual = fin_curves::myCalibration::eval_node_residual(yr_fracs, zrs_quote, idx, interp_def.zr_type, interp_def.zr_interp, this->calib_eqs[idx], quote_chg);
+            zrs_quote[idx] = lib_math::chain(residual, zrs[idx], -1.0 / residual_derivs[idx]);
+            for (std::size_t lane = 0; (lane < lanes_no) && (quote_first + lane < nodes_no); lane++)
+                jacobian[idx][quote_first + lane] = zrs_quote[idx].grad[lane];
+        }
+    }
+
+    return jacobian;
+}
+
+// get adjoints of pillar quotes given adjoints of node zero rates
+std::vector<double> fin_curves::myBootstrap::get_quotes_adj(const std::vector<double>& zrs_adj) const
+{
+    std::vector<std::tuple<double, double>> dsc_dfs_adj;
+    return this->get_quotes_adj(zrs_adj, dsc_dfs_adj);
+}
+
+// get adjoints of pillar quotes and of discount factors of the discount curve given adjoints of node zero rates
+std::vector<double> fin_curves::myBootstrap::get_quotes_adj(const std::vector<double>& zrs_adj, std::vector<std::tuple<double, double>>& dsc_dfs_adj) const
+{
+    std::vector<double> residual_derivs = this->get_residual_derivs();
+    std::size_t nodes_no = this->pillars.size();
+    if (zrs_adj.size() != nodes_no)
+        throw std::runtime_error((std::string)__func__ + ": Number of zero rate adjoints does not match number of nodes of curve '" + this->crv_nm + "'!");
+    std::vector<double> yr_fracs = this->crv->get_yr_fracs();
+    fin_curves::zr_interp_def interp_def = this->crv->get_def();
+
+    // zero rates are inputs of the tape holding their adjoints; they are kept when the tape is rewound
+    lib_math::myTape tape;
+    std::vector<lib_math::adjoint> zrs;
+    for (std::size_t idx = 0; idx < nodes_no; idx++)
+    {
+        zrs.push_back(lib_math::adjoint::input(tape, this->crv->get_zr(idx)));
+        tape.add_adj(zrs[idx].pos, zrs_adj[idx]);
+    }
+    std::size_t pos_start = tape.get_size();
+
+    // adjoint of zero rate of a node is complete once the nodes depending on it are swept; residual adjoint follows from the implicit function theorem.
+    // Discount factors of the discount curve enter the residual as inputs, so the same sweep gives their adjoints
+    std::vector<double> quotes_adj(nodes_no, 0.0);
+    std::map<double, double> dsc_dfs_adj_map;
+    for (std::size_t idx = nodes_no; idx-- > 0;)
+    {
+        const fin_curves::calib_eq& eq = this->calib_eqs[idx];
+        double residual_adj = -tape.get_adj(zrs[idx].pos) / residual_derivs[idx];
+        lib_math::adjoint quote_chg = lib_math::adjoint::input(tape, 0.0);
+        std::vector<lib_math::adjoint> dsc_dfs_chg;
+        for (std::size_t pos = 0; pos < eq.dsc_dfs.size() + eq.df_ratios_dsc.size(); pos++)
+            dsc_dfs_chg.push_back(lib_math::adjoint::input(tape, 0.0));
+        lib_math::adjoint residual = fin_curves::myCalibration::eval_node_residual(yr_fracs, zrs, idx, interp_def.zr_type, interp_def.zr_interp, eq, quote_chg, dsc_dfs_chg);
+        tape.add_adj(residual.pos, residual_adj);
+        tape.sweep(pos_start);
+        quotes_adj[idx] = tape.get_adj(quote_chg.pos);
+        for (std::size_t pos = 0; pos < dsc_dfs_chg.size(); pos++)
+        {
+            double yr_frac = (pos < eq.dsc_dfs.size()) ? std::get<1>(eq.dsc_dfs[pos]) : std::get<1>(eq.df_ratios_dsc[pos - eq.dsc_dfs.size()]);
+            dsc_dfs_adj_map[yr_frac] += tape.get_adj(dsc_dfs_chg[pos].pos);
+        }
+        tape.rewind(pos_start);
+    }
+
+    dsc_dfs_adj.clear();
+    for (const auto& [yr_frac, adj] : dsc_dfs_adj_map)
+        dsc_dfs_adj.push_back({yr_frac, adj});
+    return quotes_adj;
+}
@@ -0,0 +1,394 @@
+/** \example fin_bootstrap_examples.h
+ * @file fin_bootstrap.h
+ * @author Michal Mackanic
+ * @brief Bootstrap zero rate curve from market quotes stored in a dated quote file.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <map>
+#include "fin_generators.h"
+#include "fin_zerorate.h"
+#include "fin_fxcurve.h"
+#include "fin_irsinstr.h"
+#include "fin_bsswpinstr.h"
+#include "fin_calibration.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Curve pillar, i.e. single row of a quote file.
+     *
+     */
+    struct pillar
+    {
+        std::string tenor;
+        std::string generator;
+        std::shared_ptr<double> quote;
+        double maturity;
+    };
+
+    /**
+     * @brief State of a bootstrapped curve, i.e. its pillars, calibration equations and swap strips together with zero rates and FX forwards of its nodes;
+     * see myBootstrap::get_state().
+     *
+     */
+    struct bootstrap_state
+    {
+        std::vector<fin_curves::pillar> pillars;
+        std::map<std::string, std::shared_ptr<fin_curves::myIrsInstr>> irs_strips;
+        std::map<std::string, std::shared_ptr<fin_curves::myBsSwpInstr>> bs_strips;
+        std::vector<fin_curves::calib_eq> calib_eqs;
+        std::vector<std::vector<std::size_t>> nodes_deps;
+        std::vector<std::size_t> fx_idxs;
+        std::size_t calib_iters_no = 0;
+        std::vector<double> yr_fracs;
+        std::vector<double> zrs;
+        std::vector<double> yr_fracs_fx;
+        std::vector<double> fxs;
+    };
+
+    /**
+     * @brief Object bootstrapping zero rate curve from market quotes.
+     *
+     */
+    class myBootstrap
+    {
+        private:
+            std::string path;
+            std::string crv_nm;
+            std::string date;
+            std::string sep;
+            bool quotes;
+            std::vector<fin_curves::pillar> pillars;
+            std::vector<std::string> generator_nms;
+            std::shared_ptr<fin_curves::myGenerators> generators;
+            std::shared_ptr<fin_curves::myZeroRate> crv;
+            std::shared_ptr<fin_curves::myZeroRate> dsc_crv;
+            std::shared_ptr<fin_curves::myFxCurve> fx_crv;
+            std::shared_ptr<fin_curves::myZeroRate> fx_oth_crv;
+            std::shared_ptr<fin_curves::myZeroRate> dom_prj_crv;
+            std::shared_ptr<fin_curves::myZeroRate> for_prj_crv;
+            std::map<std::string, std::shared_ptr<fin_curves::myIrsInstr>> irs_strips;
+            std::map<std::string, std::shared_ptr<fin_curves::myBsSwpInstr>> bs_strips;
+            std::vector<fin_curves::calib_eq> calib_eqs;
+            std::vector<std::vector<std::size_t>> nodes_deps;
+            std::vector<std::size_t> fx_idxs;
+            std::size_t calib_iters_no = 0;
+
+            /**
+             * @brief Interpolate missing quotes using quotes of the same generator.
+             *
+             */
+            void interp_quotes();
+
+            /**
+             * @brief Check whether curve nodes are solved one by one, i.e. interpolation between a node and the preceding nodes does not depend on the
+             * following nodes; throws for interpolations the bootstrap does not support.
+             *
+             * @return true Nodes are solved one by one, i.e. linear and log-linear interpolation.
+             * @return false Nodes are calibrated at once, i.e. cubic spline and monotone convex interpolation.
+             */
+            bool is_sequential() const;
+
+            /**
+             * @brief Evaluate pillars one by one in the order of their maturity, i.e. place curve nodes, collect their calibration equations and solve their
+             * zero rates as in sequential bootstrap. Instruments solve their nodes under linear interpolation of zero rates, so nodes of log-linear
+             * interpolation are re-solved one by one afterwards. Given an initial curve, swap nodes are not solved and take zero rates of the initial curve
+             * instead, i.e. nodes are only placed for calibration at once.
+             *
+             * @param crv_init Initial zero rate curve; nullptr => nodes are solved.
+             */
+            void set_nodes(const std::shared_ptr<fin_curves::myZeroRate>& crv_init);
+
+            /**
+             * @brief Solve zero rates of all curve nodes at once using interpolation of the curve; FX forwards implied by cross-currency basis swaps are
+             * re-evaluated.
+             *
+             * @param crv_init Initial zero rate curve; nullptr => zero rates of the curve nodes are used.
+             */
+            void solve_global(const std::shared_ptr<fin_curves::myZeroRate>& crv_init);
+
+            /**
+             * @brief Replace zero rates of all curve nodes; FX forwards implied by cross-currency basis swaps are re-evaluated.
+             *
+             * @param zrs Zero rates of curve nodes.
+             */
+            void load_zrs(const std::vector<double>& zrs);
+
+            /**
+             * @brief Re-evaluate FX forwards implied by cross-currency basis swaps of re-solved curve nodes.
+             *
+             * @param fxs FX forwards of the FX curve nodes to be updated.
+             * @param is_affected Flags of re-solved curve nodes.
+             */
+            void set_bs_fxs(std::vector<double>& fxs, const std::vector<bool>& is_affected) const;
+
+            /**
+             * @brief Rebuild calibration equation of a pillar; instruments are evaluated against curve nodes preceding the pillar and swap strips reuse their
+             * schedules.
+             *
+             * @param idx Position index of the pillar among pillars sorted by maturity.
+             * @param yr_fracs Year fractions of curve nodes.
+             * @param zrs Zero rates of curve nodes.
+             * @param fxs FX forwards of the FX curve nodes; forward implied by an FX swap pillar is updated.
+             */
+            void set_calib_eq(const std::size_t& idx, const std::vector<double>& yr_fracs, const std::vector<double>& zrs, std::vector<double>& fxs);
+
+            /**
+             * @brief Find preceding curve nodes a curve node depends on in sequential bootstrap, i.e. nodes interpolating discount factors referenced by its
+             * calibration equation.
+             *
+             * @param yr_fracs Year fractions of curve nodes.
+             * @param idx Position index of the curve node.
+             * @return std::vector<std::size_t> Sorted position indices of the preceding curve nodes.
+             */
+            std::vector<std::size_t> find_node_deps(const std::vector<double>& yr_fracs, const std::size_t& idx) const;
+
+            /**
+             * @brief Get derivatives of residuals of calibration equations of the bootstrapped curve nodes with respect to their own zero rates.
+             *
+             * @return std::vector<double> Derivatives; throws if the curve has not been bootstrapped with the current pillars or its nodes are not solved
+             * one by one.
+             */
+            std::vector<double> get_residual_derivs() const;
+
+        public:
+            /**
+             * @brief Construct a new myBootstrap object using curve definition stored in a .csv file.
+             *
+             * @param path Path to data folder; curve definition is expected in its "inputs/curves/" subfolder.
+             * @param crv_nm Curve name that corresponds to .csv file name with curve interpolation definition.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            myBootstrap(const std::string& path, const std::string& crv_nm, const std::string& sep = ",", const bool& quotes = false);
+
+            /**
+             * @brief Construct a new myBootstrap object using provided curve interpolation definition, e.g. stored definition with other interpolation.
+             *
+             * @param path Path to data folder.
+             * @param crv_nm Curve name that corresponds to quote file names.
+             * @param interp_def Curve interpolation definition.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            myBootstrap(const std::string& path, const std::string& crv_nm, const fin_curves::zr_interp_def& interp_def, const std::string& sep = ",", const bool& quotes = false);
+
+            /**
+             * @brief Load market quotes from a quote file named after curve and date, e.g. "eur_ri_3m_fo_20220531.csv", with columns tenor, generator and quote.
+             *
+             * @param date Date of the market quotes.
+             * @param date_format Format of the date.
+             */
+            void load(const std::string& date, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Load market quotes stored in vectors. Pillars are sorted by maturity and missing quotes, identified through a null pointer, are interpolated.
+             *
+             * @param date Date of the market quotes.
+             * @param tenors Vector of frequency strings defining pillar maturities, e.g. "ON", "TN", "1M", "1Y3M", etc.
+             * @param generator_nms Vector of generator names used to evaluate the individual pillars.
+             * @param quotes Vector of market quotes.
+             * @param date_format Format of the date.
+             */
+            void load(const std::string& date, const std::vector<std::string>& tenors, const std::vector<std::string>& generator_nms, const std::vector<std::shared_ptr<double>>& quotes, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Bootstrap zero rate curve, i.e. evaluate pillars one by one in the order of their maturity. Cubic spline moves zero rates of all nodes
+             * and monotone convex forwards of a segment depend on the following node, so their nodes are calibrated at once afterwards, see run_global().
+             *
+             */
+            void run();
+
+            /**
+             * @brief Calibrate zero rate curve globally, i.e. solve zero rates of all nodes at once so that all pillars are repriced simultaneously. This
+             * is needed when instruments overlap, e.g. swap cash flows depend on nodes of FRAs with later maturity. Without an initial curve, curve nodes,
+             * calibration equations and initial zero rates are obtained from the sequential bootstrap; with an initial curve, swaps only place their nodes
+             * and provide their calibration equations without being solved. Discount factors follow interpolation of the curve, e.g. cubic spline.
+             *
+             * @param crv_init Initial zero rate curve, e.g. curve of the previous business day; nullptr => zero rates of the sequential bootstrap are used.
+             */
+            void run_global(const std::shared_ptr<fin_curves::myZeroRate>& crv_init = nullptr);
+
+            /**
+             * @brief Update quote of a single pillar of an already bootstrapped curve and re-solve only the curve node of the pillar and the following nodes
+             * depending on it, directly or through other re-solved nodes. Nodes not affected by the quote keep their zero rates and swap strips keep their
+             * coupon schedules. FX forwards implied by the re-solved pillars are updated as well. Nodes calibrated at once, i.e. cubic spline and monotone
+             * convex interpolation, are all re-calibrated starting from their current zero rates.
+             *
+             * @param idx Position index of the pillar among pillars sorted by maturity.
+             * @param quote New market quote of the pillar.
+             * @return std::size_t Number of re-solved curve nodes.
+             */
+            std::size_t update(const std::size_t& idx, const double& quote);
+
+            /**
+             * @brief Update quote of a single pillar of an already bootstrapped curve identified by its tenor and generator; see update() above.
+             *
+             * @param tenor Frequency string defining pillar maturity, e.g. "7M", "1Y3M".
+             * @param generator_nm Generator name of the pillar.
+             * @param quote New market quote of the pillar.
+             * @return std::size_t Number of re-solved curve nodes.
+             */
+            std::size_t update(const std::string& tenor, const std::string& generator_nm, const double& quote);
+
+            /**
+             * @brief Re-solve an already bootstrapped curve after its input curves changed beyond a year fraction, e.g. discount curve bumped through its
+             * bootstrap. Pillars maturing up to the year fraction keep their nodes, pillars maturing later get new swap strips and their calibration equations
+             * are rebuilt against the input curves. Only nodes of changed equations and the following nodes depending on them, directly or through other
+             * re-solved nodes, are re-solved; FX forwards implied by the re-solved pillars are updated as well. Nodes calibrated at once, i.e. cubic spline and monotone convex interpolation, are all re-calibrated starting from their current zero rates.
+             *
+             * @param yr_frac Year fraction up to which discount factors and forwards of the input curves did not change, see get_yr_frac_same(); 0 => all
+             * pillars are re-solved.
+             * @return std::size_t Number of re-solved curve nodes.
+             */
+            std::size_t refresh(const double& yr_frac);
+
+            /**
+             * @brief Get year fraction up to which discount factors of the curve equal those of a saved state, i.e. the year fraction a curve depending on
+             * this curve can be refreshed from, see refresh(). Node of linearly interpolated zero rates or log-linear discount factors moves the curve only
+             * after the preceding node, a node of other interpolations moves the whole curve.
+             *
+             * @param state State of the curve, see get_state().
+             * @return double Year fraction; infinity => curve equals the state.
+             */
+            double get_yr_frac_same(const fin_curves::bootstrap_state& state) const;
+
+            /**
+             * @brief Get preceding curve nodes a curve node depends on in sequential bootstrap.
+             *
+             * @param idx Position index of the curve node.
+             * @return std::vector<std::size_t> Sorted position indices of the preceding curve nodes.
+             */
+            std::vector<std::size_t> get_node_deps(const std::size_t& idx) const {return this->nodes_deps[idx];};
+
+            /**
+             * @brief Get Jacobian of zero rates of curve nodes with respect to market quotes of the pillars. Calibration equations are differentiated node by
+             * node using forward-mode automatic differentiation, gradients with respect to several quotes are carried together in lanes of dual numbers and
+             * each node takes its gradient from the implicit function theorem, i.e. dzr = -(dresidual / dquote + sum(dresidual / dzr_prev * dzr_prev))
+             * / (dresidual / dzr). Quotes of curves the curve depends on are held fixed.
+             *
+             * @return std::vector<std::vector<double>> Jacobian; element [i][j] is derivative of zero rate of node i with respect to quote of pillar j.
+             */
+            std::vector<std::vector<double>> get_jacobian() const;
+
+            /**
+             * @brief Get adjoints of market quotes of the pillars given adjoints of zero rates of curve nodes, e.g. gradient of portfolio value with respect to
+             * the quotes given its gradient with respect to the zero rates, see myAdjointCurve. Adjoints are propagated backwards through the bootstrap in one
+             * sweep, so the cost does not depend on the number of quotes. The bootstrapped curve serves as checkpoint: calibration equation of each node is
+             * re-recorded on tape from the zero rates when the sweep reaches the node and the tape is rewound afterwards. Quotes of curves the curve depends
+             * on are held fixed.
+             *
+             * @param zrs_adj Adjoints of zero rates of curve nodes.
+             * @return std::vector<double> Adjoints of quotes of the pillars.
+             */
+            std::vector<double> get_quotes_adj(const std::vector<double>& zrs_adj) const;
+
+            /**
+             * @brief Get adjoints of market quotes of the pillars given adjoints of zero rates of curve nodes together with adjoints of discount factors of the
+             * discount curve, i.e. partial derivatives of the calibration equations with respect to discount factors of swap cash flows weighted by adjoints
+             * of the equations. Passed to the discount curve, see myAdjointCurve::add_dfs_adj(), and through its bootstrap, they give sensitivity to quotes of
+             * the discount curve flowing through the curve. Only interest rate swaps discounted by the discount curve contribute.
+             *
+             * @param zrs_adj Adjoints of zero rates of curve nodes.
+             * @param dsc_dfs_adj Adjoints of discount factors of the discount curve as pairs of year fraction and adjoint sorted by year fraction.
+             * @return std::vector<double> Adjoints of quotes of the pillars.
+             */
+            std::vector<double> get_quotes_adj(const std::vector<double>& zrs_adj, std::vector<std::tuple<double, double>>& dsc_dfs_adj) const;
+
+            /**
+             * @brief Get number of Newton iterations needed by the last global calibration.
+             *
+             * @return std::size_t Number of iterations.
+             */
+            std::size_t get_calib_iters_no() const {return this->calib_iters_no;};
+
+            /**
+             * @brief Get the largest absolute residual of calibration equations of all pillars evaluated on the current curve nodes, i.e. with the following
+             * nodes in place. After sequential bootstrap it is non-zero only if instruments overlap, e.g. swap cash flows depend on nodes of FRAs with later
+             * maturity.
+             *
+             * @return double Largest absolute residual.
+             */
+            double get_residual_max() const;
+
+            /**
+             * @brief Get state of the bootstrapped curve, e.g. to restore the curve after its quotes were bumped or after its input curves changed and the
+             * curve was bootstrapped again.
+             *
+             * @return fin_curves::bootstrap_state State of the curve.
+             */
+            fin_curves::bootstrap_state get_state() const;
+
+            /**
+             * @brief Restore state of the curve saved by get_state(). Zero rates and FX forwards are loaded into the curve and FX curve of the bootstrap, so
+             * that curves sharing them see the restored nodes; restored curve is exactly the saved one, i.e. no node is re-solved.
+             *
+             * @param state State of the curve.
+             */
+            void set_state(const fin_curves::bootstrap_state& state);
+
+            /**
+             * @brief Set zero rate curve used to discount cash flows of swap instruments; nullptr => cash flows are discounted by the curve being bootstrapped.
+             *
+             * @param dsc_crv Discount zero rate curve.
+             */
+            void set_dsc_crv(const std::shared_ptr<fin_curves::myZeroRate>& dsc_crv) {this->dsc_crv = dsc_crv;};
+
+            /**
+             * @brief Set FX curve and zero rate curve of the other currency of the FX pair; they are needed by FX swap instruments. FX forwards of the FX curve
+             * are rebuilt together with the zero rate curve and only FX spot rate is kept.
+             *
+             * @param fx_crv FX curve holding FX spot rate.
+             * @param fx_oth_crv Zero rate curve of the other currency of the FX pair.
+             */
+            void set_fx_crv(const std::shared_ptr<fin_curves::myFxCurve>& fx_crv, const std::shared_ptr<fin_curves::myZeroRate>& fx_oth_crv) {this->fx_crv = fx_crv; this->fx_oth_crv = fx_oth_crv;};
+
+            /**
+             * @brief Set projection curves of domestic and foreign legs of cross-currency basis swaps. The leg of the other currency of the FX pair is discounted
+             * by the zero rate curve set through set_fx_crv().
+             *
+             * @param dom_prj_crv Zero rate curve projecting forwards of the domestic leg.
+             * @param for_prj_crv Zero rate curve projecting forwards of the foreign leg.
+             */
+            void set_prj_crvs(const std::shared_ptr<fin_curves::myZeroRate>& dom_prj_crv, const std::shared_ptr<fin_curves::myZeroRate>& for_prj_crv) {this->dom_prj_crv = dom_prj_crv; this->for_prj_crv = for_prj_crv;};
+
+            /**
+             * @brief Get FX curve rebuilt by FX swap and cross-currency basis swap instruments.
+             *
+             * @return std::shared_ptr<fin_curves::myFxCurve> FX curve.
+             */
+            std::shared_ptr<fin_curves::myFxCurve> get_fx_crv() const {return this->fx_crv;};
+
+            /**
+             * @brief Get bootstrapped zero rate curve.
+             *
+             * @return std::shared_ptr<fin_curves::myZeroRate> Zero rate curve.
+             */
+            std::shared_ptr<fin_curves::myZeroRate> get_crv() const {return this->crv;};
+
+            /**
+             * @brief Get pillars sorted by their maturity.
+             *
+             * @return std::vector<fin_curves::pillar> Vector of pillars.
+             */
+            std::vector<fin_curves::pillar> get_pillars() const {return this->pillars;};
+
+            /**
+             * @brief Save bootstrapped zero rates and, if set, FX forwards into "outputs/curves/" subfolder of the data folder.
+             *
+             * @param sep Separator to be used in the .csv file.
+             * @param suffix Suffix of the file names, e.g. "_pokus" not to overwrite saved curves of the same date; "" => no suffix.
+             */
+            void save(const std::string& sep = ",", const std::string& suffix = "");
+    };
+}
@@ -0,0 +1,379 @@
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "fin_date.h"
+#include "fin_curves.h"
+#include "fin_zerorate.h"
+#include "fin_bsswpinstr.h"
+
+fin_curves::myBsSwpInstr::myBsSwpInstr(const std::string& date, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, const std::shared_ptr<fin_curves::myZeroRate>& dom_prj_crv, const std::shared_ptr<fin_curves::myZeroRate>& for_prj_crv, const std::shared_ptr<fin_curves::myZeroRate>& oth_crv, const std::shared_ptr<fin_curves::myFxCurve>& fx_crv, std::string date_format)
+{
+    // check that the generator is cross-currency basis swap
+    if (generator->instr_tp.compare("bsswp") != 0)
+        throw std::runtime_error((std::string)__func__ + ": Instrument '" + generator->instr_nm + "' is not a cross-currency basis swap!");
+
+    // check that all curves were provided
+    if ((dom_prj_crv == nullptr) || (for_prj_crv == nullptr) || (oth_crv == nullptr))
+        throw std::runtime_error((std::string)__func__ + ": Projection and discount curves of swap '" + generator->instr_nm + "' are not set!");
+
+    // determine which leg is discounted by the curve being bootstrapped; the other leg is discounted by the curve of the other currency
+    std::string ccy = crv.get_def().ccy;
+    std::string oth_ccy = oth_crv->get_def().ccy;
+    std::string dom_ccy = dom_prj_crv->get_def().ccy;
+    std::string for_ccy = for_prj_crv->get_def().ccy;
+    if ((dom_ccy.compare(ccy) == 0) && (for_ccy.compare(oth_ccy) == 0))
+        this->is_dom_solved = true;
+    else if ((for_ccy.compare(ccy) == 0) && (dom_ccy.compare(oth_ccy) == 0))
+        this->is_dom_solved = false;
+    else
+        throw std::runtime_error((std::string)__func__ + ": Currencies of projection curves of swap '" + generator->instr_nm + "' do not match currencies '" + ccy + "' and '" + oth_ccy + "'!");
+
+    // store variables into the object
+    this->date_exec = lib_date::myDate(date, date_format);
+    this->generator = generator;
+    this->fx_crv = fx_crv;
+    this->is_ccy1 = (fx_crv != nullptr) && (ccy.compare(fx_crv->get_def().ccy1) == 0);
+    this->zr_dcm = crv.get_def().zr_dcm;
+    this->zr_type = crv.get_def().zr_type;
+    this->yr_frac_last = 0.0;
+    this->yr_frac_fx = 0.0;
+    this->fx = 0.0;
+    this->iters_no = 0;
+
+    // get calendars
+    const fin_curves::bsswp& bsswp = generator->instr_def.bsswp;
+    std::size_t year_start = this->date_exec.get_year();
+    this->holidays_dom_pmt = &fin_date::get_holidays(bsswp.dom_leg_cal_pmt, year_start, year_start + 100);
+    this->holidays_for_pmt = &fin_date::get_holidays(bsswp.for_leg_cal_pmt, year_start, year_start + 100);
+    const std::vector<lib_date::myDate>& holidays_dom_fix = fin_date::get_holidays(bsswp.dom_leg_cal_fix, year_start, year_start + 100);
+    const std::vector<lib_date::myDate>& holidays_for_fix = fin_date::get_holidays(bsswp.for_leg_cal_fix, year_start, year_start + 100);
+
+    // leg discounted by the curve being bootstrapped has no discount curve assigned
+    this->dom_leg.prj_crv = dom_prj_crv;
+    this->dom_leg.dsc_crv = this->is_dom_solved ? nullptr : oth_crv;
+    this->dom_leg.freq = fin_date::decompose_freq(bsswp.dom_leg_freq);
+    this->dom_leg.date_spot = this->date_exec;
+    if (bsswp.dom_leg_days_shift > 0)
+        this->dom_leg.date_spot.add_working_days(holidays_dom_fix, bsswp.dom_leg_days_shift);
+
+    this->for_leg.prj_crv = for_prj_crv;
+    this->for_leg.dsc_crv = this->is_dom_solved ? oth_crv : nullptr;
+    this->for_leg.freq = fin_date::decompose_freq(bsswp.for_leg_freq);
+    this->for_leg.date_spot = this->date_exec;
+    if (bsswp.for_leg_days_shift > 0)
+        this->for_leg.date_spot.add_working_days(holidays_for_fix, bsswp.for_leg_days_shift);
+
+    for (fin_curves::bs_leg* leg : {&this->dom_leg, &this->for_leg})
+    {
+        std::string dsc_dcm = (leg->dsc_crv == nullptr) ? this->zr_dcm : leg->dsc_crv->get_def().zr_dcm;
+        leg->yr_frac_spot_prj = fin_date::day_count_method(this->date_exec, leg->date_spot, leg->prj_crv->get_def().zr_dcm);
+        leg->yr_frac_spot_dsc = fin_date::day_count_method(this->date_exec, leg->date_spot, dsc_dcm);
+        leg->cpns_done_no = 0;
+        leg->fwd_pv_done = 0.0;
+        leg->annuity_done = 0.0;
+    }
+}
+
+// generate regular coupons of a leg up to a specified number of coupons
+void fin_curves::myBsSwpInstr::extend_leg(fin_curves::bs_leg& leg, const std::size_t& cpns_no, const std::string& cal, const std::string& dcm)
+{
+    if (leg.dates.size() >= cpns_no)
+        return;
+
+    std::string prj_dcm = leg.prj_crv->get_def().zr_dcm;
+    std::string dsc_dcm = (leg.dsc_crv == nullptr) ? this->zr_dcm : leg.dsc_crv->get_def().zr_dcm;
+
+    // coupon dates are shared with bootstraps of the same date processed by the thread before
+    std::size_t year_start = this->date_exec.get_year();
+    std::vector<lib_date::myDate> dates_cpn = fin_date::get_cpn_dates(leg.date_spot, leg.freq, cpns_no, cal, year_start, year_start + 100, this->generator->instr_def.bsswp.drm);
+    for (std::size_t cpn_no = leg.dates.size() + 1; cpn_no <= cpns_no; cpn_no++)
+    {
+        const lib_date::myDate& date_cpn = dates_cpn[cpn_no - 1];
+
+        // projected forward times accrual year fraction, i.e. ratio of projection discount factors minus one
+        const lib_date::myDate& date_prev = (cpn_no == 1) ? leg.date_spot : leg.dates.back();
+        double yr_frac_begin = fin_date::day_count_method(this->date_exec, date_prev, prj_dcm);
+        double yr_frac_end = fin_date::day_count_method(this->date_exec, date_cpn, prj_dcm);
+        double df_begin = (yr_frac_begin > 0.0) ? leg.prj_crv->get_df(yr_frac_begin) : 1.0;
+        leg.fwds.push_back(df_begin / leg.prj_crv->get_df(yr_frac_end) - 1.0);
+
+        leg.yr_fracs_acr.push_back(fin_date::day_count_method(date_prev, date_cpn, dcm));
+        leg.yr_fracs_dsc.push_back(fin_date::day_count_method(this->date_exec, date_cpn, dsc_dcm));
+        leg.dates.push_back(date_cpn);
+    }
+}
+
+// generate schedule of a swap of the strip
+fin_curves::bs_swp fin_curves::myBsSwpInstr::get_swp(const std::string& tenor)
+{
+    const fin_curves::bsswp& bsswp = this->generator->instr_def.bsswp;
+    fin_curves::bs_swp swp;
+
+    // express tenor and coupon frequencies in months; errors are reported under name of this function
+    const std::string func_nm = __func__;
+    auto get_months = [&](const std::tuple<int, std::string>& freq) -> int
+    {
+        if (std::get<1>(freq).compare("Y") == 0)
+            return 12 * std::get<0>(freq);
+        else if (std::get<1>(freq).compare("M") == 0)
+            return std::get<0>(freq);
+        else
+            throw std::runtime_error(func_nm + ": Swap '" + this->generator->instr_nm + "' supports only monthly and yearly tenors and frequencies!");
+    };
+    std::tuple<int, std::string> freq_end = fin_date::decompose_freq(tenor);
+    int months_end = get_months(freq_end);
+    swp.dom_cpns_no = (months_end - 1) / get_months(this->dom_leg.freq);
+    swp.for_cpns_no = (months_end - 1) / get_months(this->for_leg.freq);
+
+    // regular coupons are shared with the preceding swaps of the strip; only the missing ones are generated
+    this->extend_leg(this->dom_leg, swp.dom_cpns_no, bsswp.dom_leg_cal_pmt, bsswp.dom_leg_dcm);
+    this->extend_leg(this->for_leg, swp.for_cpns_no, bsswp.for_leg_cal_pmt, bsswp.for_leg_dcm);
+
+    // the last coupon of a leg ends at swap maturity; its projected forward, accrual and discount year fractions are specific for the swap
+    auto get_last_cpn = [&](const fin_curves::bs_leg& leg, const std::size_t& cpns_no, const std::vector<lib_date::myDate>& holidays, const std::string& dcm) -> fin_curves::bs_last_cpn
+    {
+        std::string prj_dcm = leg.prj_crv->get_def().zr_dcm;
+        std::string dsc_dcm = (leg.dsc_crv == nullptr) ? this->zr_dcm : leg.dsc_crv->get_def().zr_dcm;
+
+        fin_curves::bs_last_cpn cpn;
+        cpn.date_end = leg.date_spot;
+        cpn.date_end.add(fin_date::compose_freq(freq_end));
+        fin_date::date_rolling(cpn.date_end, holidays, bsswp.drm);
+
+        const lib_date::myDate& date_prev = (cpns_no == 0) ? leg.date_spot : leg.dates[cpns_no - 1];
+        double yr_frac_begin = fin_date::day_count_method(this->date_exec, date_prev, prj_dcm);
+        double df_begin = (yr_frac_begin > 0.0) ? leg.prj_crv->get_df(yr_frac_begin) : 1.0;
+        cpn.fwd = df_begin / leg.prj_crv->get_df(fin_date::day_count_method(this->date_exec, cpn.date_end, prj_dcm)) - 1.0;
+        cpn.yr_frac_acr = fin_date::day_count_method(date_prev, cpn.date_end, dcm);
+        cpn.yr_frac_dsc = fin_date::day_count_method(this->date_exec, cpn.date_end, dsc_dcm);
+        return cpn;
+    };
+    swp.dom_cpn = get_last_cpn(this->dom_leg, swp.dom_cpns_no, *this->holidays_dom_pmt, bsswp.dom_leg_dcm);
+    swp.for_cpn = get_last_cpn(this->for_leg, swp.for_cpns_no, *this->holidays_for_pmt, bsswp.for_leg_dcm);
+
+    return swp;
+}
+
+// build calibration equation of a swap of the strip
+fin_curves::calib_eq fin_curves::myBsSwpInstr::build_calib_eq(const fin_curves::bs_swp& swp, const double& spread, const double& pv_known, const double& pv_known_deriv) const
+{
+    // present value of the leg discounted by the curve being bootstrapped minus present value of the other leg
+    const fin_curves::bs_leg& leg_solved = this->is_dom_solved ? this->dom_leg : this->for_leg;
+    const fin_curves::bs_last_cpn& cpn_solved = this->is_dom_solved ? swp.dom_cpn : swp.for_cpn;
+    std::size_t cpns_solved_no = this->is_dom_solved ? swp.dom_cpns_no : swp.for_cpns_no;
+    double spread_solved = this->is_dom_solved ? spread : 0.0;
+
+    double spread_deriv = this->is_dom_solved ? 1.0 : 0.0;
+
+    fin_curves::calib_eq eq;
+    eq.cst = -pv_known;
+    eq.cst_deriv = -pv_known_deriv;
+    eq.dfs.push_back({-1.0, leg_solved.yr_frac_spot_dsc});
+    eq.dfs_derivs.push_back(0.0);
+    for (std::size_t idx = 0; idx < cpns_solved_no; idx++)
+    {
+        eq.dfs.push_back({leg_solved.fwds[idx] + spread_solved * leg_solved.yr_fracs_acr[idx], leg_solved.yr_fracs_dsc[idx]});
+        eq.dfs_derivs.push_back(spread_deriv * leg_solved.yr_fracs_acr[idx]);
+    }
+    eq.dfs.push_back({1.0 + cpn_solved.fwd + spread_solved * cpn_solved.yr_frac_acr, cpn_solved.yr_frac_dsc});
+    eq.dfs_derivs.push_back(spread_deriv * cpn_solved.yr_frac_acr);
+
+    return eq;
+}
+
+// calculate FX forward implied by a swap of the strip
+void fin_curves::myBsSwpInstr::set_fx(const fin_curves::bs_swp& swp, const double& df_spot, const double& df_end)
+{
+    // covered interest parity relative to spot date of the solved leg, i.e. fx / spot = (df_ccy1(end) / df_ccy1(spot)) / (df_ccy2(end) / df_ccy2(spot))
+    const fin_curves::bs_leg& leg_solved = this->is_dom_solved ? this->dom_leg : this->for_leg;
+    const fin_curves::bs_leg& leg_known = this->is_dom_solved ? this->for_leg : this->dom_leg;
+    const fin_curves::bs_last_cpn& cpn_solved = this->is_dom_solved ? swp.dom_cpn : swp.for_cpn;
+
+    std::shared_ptr<fin_curves::myZeroRate> oth_crv = leg_known.dsc_crv;
+    std::string oth_dcm = oth_crv->get_def().zr_dcm;
+    double oth_yr_frac_spot = fin_date::day_count_method(this->date_exec, leg_solved.date_spot, oth_dcm);
+    double oth_df_spot = (oth_yr_frac_spot > 0.0) ? oth_crv->get_df(oth_yr_frac_spot) : 1.0;
+    double oth_df_end = oth_crv->get_df(fin_date::day_count_method(this->date_exec, cpn_solved.date_end, oth_dcm));
+    double ratio = (df_end / df_spot) / (oth_df_end / oth_df_spot);
+
+    if (this->is_ccy1)
+        this->fx = this->fx_crv->get_spot() * ratio;
+    else
+        this->fx = this->fx_crv->get_spot() / ratio;
+    this->yr_frac_fx = fin_date::day_count_method(this->date_exec, cpn_solved.date_end, this->fx_crv->get_def().dcm);
+}
+
+// get calibration equation of a swap of the strip
+fin_curves::calib_eq fin_curves::myBsSwpInstr::get_calib_eq(const std::string& tenor, const double& spread)
+{
+    fin_curves::bs_swp swp = this->get_swp(tenor);
+
+    // present value of the known leg per unit of notional including exchange of notionals; cached present values of the strip might cover more coupons than
+    // the swap has, so the leg is valued from scratch
+    const fin_curves::bs_leg& leg_known = this->is_dom_solved ? this->for_leg : this->dom_leg;
+    const fin_curves::bs_last_cpn& cpn_known = this->is_dom_solved ? swp.for_cpn : swp.dom_cpn;
+    std::size_t cpns_known_no = this->is_dom_solved ? swp.for_cpns_no : swp.dom_cpns_no;
+    double spread_known = this->is_dom_solved ? 0.0 : spread;
+    double spread_deriv = this->is_dom_solved ? 0.0 : 1.0;
+    double pv_known = (leg_known.yr_frac_spot_dsc > 0.0) ? -leg_known.dsc_crv->get_df(leg_known.yr_frac_spot_dsc) : -1.0;
+    double pv_known_deriv = 0.0;
+    for (std::size_t idx = 0; idx < cpns_known_no; idx++)
+    {
+        double df = leg_known.dsc_crv->get_df(leg_known.yr_fracs_dsc[idx]);
+        pv_known += (leg_known.fwds[idx] + spread_known * leg_known.yr_fracs_acr[idx]) * df;
+        pv_known_deriv += spread_deriv * leg_known.yr_fracs_acr[idx] * df;
+    }
+    double df_end = leg_known.dsc_crv->get_df(cpn_known.yr_frac_dsc);
+    pv_known += (1.0 + cpn_known.fwd + spread_known * cpn_known.yr_frac_acr) * df_end;
+    pv_known_deriv += spread_deriv * cpn_known.yr_frac_acr * df_end;
+
+    return this->build_calib_eq(swp, spread, pv_known, pv_known_deriv);
+}
+
+// get year fraction of the curve node of a swap of the strip
+double fin_curves::myBsSwpInstr::get_yr_frac_node(const std::string& tenor)
+{
+    fin_curves::bs_swp swp = this->get_swp(tenor);
+    return this->is_dom_solved ? swp.dom_cpn.yr_frac_dsc : swp.for_cpn.yr_frac_dsc;
+}
+
+// get FX forward implied by a swap of the strip
+std::tuple<double, double> fin_curves::myBsSwpInstr::get_yr_frac_fx(const std::string& tenor, const fin_curves::myZeroRate& crv)
+{
+    if (this->fx_crv == nullptr)
+        throw std::runtime_error((std::string)__func__ + ": FX curve of swap strip '" + this->generator->instr_nm + "' is not set!");
+
+    fin_curves::bs_swp swp = this->get_swp(tenor);
+    const fin_curves::bs_leg& leg_solved = this->is_dom_solved ? this->dom_leg : this->for_leg;
+    const fin_curves::bs_last_cpn& cpn_solved = this->is_dom_solved ? swp.dom_cpn : swp.for_cpn;
+    double df_spot = (leg_solved.yr_frac_spot_dsc > 0.0) ? crv.get_df(leg_solved.yr_frac_spot_dsc) : 1.0;
+    this->set_fx(swp, df_spot, crv.get_df(cpn_solved.yr_frac_dsc));
+
+    return {this->yr_frac_fx, this->fx};
+}
+
+// solve zero rate of the next swap of the strip
+std::tuple<double, double> fin_curves::myBsSwpInstr::solve(const std::string& tenor, const double& spread, const fin_curves::myZeroRate& crv)
+{
+    // swap schedule
+    fin_curves::bs_swp swp = this->get_swp(tenor);
+    std::size_t dom_cpns_no = swp.dom_cpns_no;
+    std::size_t for_cpns_no = swp.for_cpns_no;
+    const fin_curves::bs_last_cpn& dom_cpn = swp.dom_cpn;
+    const fin_curves::bs_last_cpn& for_cpn = swp.for_cpn;
+
+    // swap maturity node is the maturity of the leg discounted by the curve being bootstrapped
+    fin_curves::bs_leg& leg_solved = this->is_dom_solved ? this->dom_leg : this->for_leg;
+    const fin_curves::bs_last_cpn& cpn_solved = this->is_dom_solved ? dom_cpn : for_cpn;
+    std::size_t cpns_solved_no = this->is_dom_solved ? dom_cpns_no : for_cpns_no;
+    double yr_frac_node = cpn_solved.yr_frac_dsc;
+
+    // last solved node of the curve
+    std::size_t nodes_no = crv.get_size();
+    bool is_empty = (nodes_no == 0);
+    double yr_frac_last = is_empty ? 0.0 : crv.get_yr_frac(nodes_no - 1);
+    double zr_last = is_empty ? 0.0 : crv.get_zr(nodes_no - 1);
+    if (yr_frac_last < this->yr_frac_last)
+        throw std::runtime_error((std::string)__func__ + ": Curve nodes of swap strip '" + this->generator->instr_nm + "' were reset; a new strip has to be created!");
+    this->yr_frac_last = yr_frac_last;
+
+    // regular coupons of the leg discounted by the known curve are fully known; coupons of the other leg are known only if they precede the last curve node
+    fin_curves::bs_leg& leg_known = this->is_dom_solved ? this->for_leg : this->dom_leg;
+    std::size_t cpns_known_no = this->is_dom_solved ? for_cpns_no : dom_cpns_no;
+    while (leg_known.cpns_done_no < cpns_known_no)
+    {
+        std::size_t idx = leg_known.cpns_done_no;
+        double df = leg_known.dsc_crv->get_df(leg_known.yr_fracs_dsc[idx]);
+        leg_known.fwd_pv_done += leg_known.fwds[idx] * df;
+        leg_known.annuity_done += leg_known.yr_fracs_acr[idx] * df;
+        leg_known.cpns_done_no++;
+    }
+
+    while ((leg_solved.cpns_done_no < cpns_solved_no) && !is_empty && (leg_solved.yr_fracs_dsc[leg_solved.cpns_done_no] <= yr_frac_last))
+    {
+        std::size_t idx = leg_solved.cpns_done_no;
+        double df = crv.get_df(leg_solved.yr_fracs_dsc[idx]);
+        leg_solved.fwd_pv_done += leg_solved.fwds[idx] * df;
+        leg_solved.annuity_done += leg_solved.yr_fracs_acr[idx] * df;
+        leg_solved.cpns_done_no++;
+    }
+
+    // discount factor of the curve being bootstrapped and its derivative with respect to the zero rate of the swap maturity node; zero rates beyond the last
+    // curve node are linearly interpolated between the last node and the swap maturity node
+    auto get_df_deriv = [&](const double& yr_frac, const double& zr_node) -> std::tuple<double, double>
+    {
+        if (yr_frac <= 0.0)
+            return {1.0, 0.0};
+        if (!is_empty && (yr_frac <= yr_frac_last))
+            return {crv.get_df(yr_frac), 0.0};
+
+        double weight = is_empty ? 1.0 : std::min(1.0, (yr_frac - yr_frac_last) / (yr_frac_node - yr_frac_last));
+        double zr = zr_last + (zr_node - zr_last) * weight;
+        double df = fin_curves::zr_to_df(zr, yr_frac, this->zr_type);
+        double df_deriv = (this->zr_type == 0) ? -yr_frac * df / (1.0 + zr) * weight : -yr_frac * df * weight;
+        return {df, df_deriv};
+    };
+
+    // present value of the known leg per unit of notional including exchange of notionals
+    double spread_known = this->is_dom_solved ? 0.0 : spread;
+    const fin_curves::bs_last_cpn& cpn_known = this->is_dom_solved ? for_cpn : dom_cpn;
+    double df_known_spot = (leg_known.yr_frac_spot_dsc > 0.0) ? leg_known.dsc_crv->get_df(leg_known.yr_frac_spot_dsc) : 1.0;
+    double df_known_end = leg_known.dsc_crv->get_df(cpn_known.yr_frac_dsc);
+    double pv_known = -df_known_spot + leg_known.fwd_pv_done + spread_known * leg_known.annuity_done;
+    pv_known += (1.0 + cpn_known.fwd + spread_known * cpn_known.yr_frac_acr) * df_known_end;
+    double pv_known_deriv = this->is_dom_solved ? 0.0 : leg_known.annuity_done + cpn_known.yr_frac_acr * df_known_end;
+
+    // solve swap maturity zero rate using Newton-Raphson method; only coupons of the solved leg following the last curve node depend on the solved zero rate
+    double spread_solved = this->is_dom_solved ? spread : 0.0;
+    double zr_node = is_empty ? 0.0 : zr_last;
+    this->iters_no = 0;
+    while (true)
+    {
+        this->iters_no++;
+        if (this->iters_no > 50)
+            throw std::runtime_error((std::string)__func__ + ": Zero rate for swap '" + this->generator->instr_nm + "' with tenor '" + tenor + "' did not converge!");
+
+        // present value of the solved leg per unit of notional including exchange of notionals
+        auto [df_spot, df_spot_deriv] = get_df_deriv(leg_solved.yr_frac_spot_dsc, zr_node);
+        double pv = -df_spot + leg_solved.fwd_pv_done + spread_solved * leg_solved.annuity_done;
+        double pv_deriv = -df_spot_deriv;
+        for (std::size_t idx = leg_solved.cpns_done_no; idx < cpns_solved_no; idx++)
+        {
+            auto [df, df_deriv] = get_df_deriv(leg_solved.yr_fracs_dsc[idx], zr_node);
+            double cf = leg_solved.fwds[idx] + spread_solved * leg_solved.yr_fracs_acr[idx];
+            pv += cf * df;
+            pv_deriv += cf * df_deriv;
+        }
+        auto [df_end, df_end_deriv] = get_df_deriv(cpn_solved.yr_frac_dsc, zr_node);
+        double cf_end = 1.0 + cpn_solved.fwd + spread_solved * cpn_solved.yr_frac_acr;
+        pv += cf_end * df_end;
+        pv_deriv += cf_end * df_end_deriv;
+
+        // Newton-Raphson step
+        double step = (pv - pv_known) / pv_deriv;
+        zr_node -= step;
+        if (std::abs(step) < 1e-14)
+            break;
+    }
+
+    // calibration equation
+    this->eq = this->build_calib_eq(swp, spread, pv_known, pv_known_deriv);
+
+    // FX forward implied by covered interest parity
+    if (this->fx_crv != nullptr)
+        this->set_fx(swp, std::get<0>(get_df_deriv(leg_solved.yr_frac_spot_dsc, zr_node)), std::get<0>(get_df_deriv(cpn_solved.yr_frac_dsc, zr_node)));
+
+    // return maturity year fraction and zero rate
+    return {yr_frac_node, zr_node};
+}
+
+// get FX forward implied by the last solved swap
+std::tuple<double, double> fin_curves::myBsSwpInstr::get_yr_frac_fx() const
+{
+    if (this->fx_crv == nullptr)
+        throw std::runtime_error((std::string)__func__ + ": FX curve of swap strip '" + this->generator->instr_nm + "' is not set!");
+
+    return {this->yr_frac_fx, this->fx};
+}
@@ -0,0 +1,214 @@
+/** \example fin_bsswpinstr_examples.h
+ * @file fin_bsswpinstr.h
+ * @author Michal Mackanic
+ * @brief Implement cross-currency basis swap instrument.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+# pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <memory>
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_fxcurve.h"
+#include "fin_generators.h"
+#include "fin_calibration.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Floating leg of a cross-currency basis swap with exchange of notionals at its start and maturity. Regular coupon dates, projected forwards and
+     * discount factors of fully known coupons are shared by all swaps of a strip and they are calculated only once.
+     *
+     */
+    struct bs_leg
+    {
+        std::shared_ptr<fin_curves::myZeroRate> prj_crv;
+        std::shared_ptr<fin_curves::myZeroRate> dsc_crv;
+        lib_date::myDate date_spot;
+        double yr_frac_spot_prj;
+        double yr_frac_spot_dsc;
+        std::tuple<int, std::string> freq;
+        std::vector<lib_date::myDate> dates;
+        std::vector<double> yr_fracs_dsc;
+        std::vector<double> yr_fracs_acr;
+        std::vector<double> fwds;
+        std::size_t cpns_done_no;
+        double fwd_pv_done;
+        double annuity_done;
+    };
+
+    /**
+     * @brief The last coupon of a leg of a cross-currency basis swap, i.e. coupon ending at swap maturity.
+     *
+     */
+    struct bs_last_cpn
+    {
+        lib_date::myDate date_end;
+        double fwd;
+        double yr_frac_acr;
+        double yr_frac_dsc;
+    };
+
+    /**
+     * @brief Schedule of a single cross-currency basis swap of a strip, i.e. number of regular coupons of its legs and their last coupons.
+     *
+     */
+    struct bs_swp
+    {
+        std::size_t dom_cpns_no;
+        std::size_t for_cpns_no;
+        fin_curves::bs_last_cpn dom_cpn;
+        fin_curves::bs_last_cpn for_cpn;
+    };
+
+    /**
+     * @brief Object evaluating strip of cross-currency basis swaps sharing the same generator, i.e. swaps are solved one by one in the order of their tenors.
+     * Both legs are projected on their own curves, the spread is paid on the domestic leg and one leg is discounted by the zero rate curve being bootstrapped,
+     * while the other one is discounted by a known curve of the other currency. Since notionals are exchanged at spot FX rate, swap is at par when present
+     * values of both legs per unit of their notionals are equal. The underlying zero rate curve is not modified; the result has to be added to the curve by the
+     * caller.
+     *
+     */
+    class myBsSwpInstr
+    {
+        private:
+            lib_date::myDate date_exec;
+            std::shared_ptr<fin_curves::generator> generator;
+            std::shared_ptr<fin_curves::myFxCurve> fx_crv;
+            const std::vector<lib_date::myDate>* holidays_dom_pmt;
+            const std::vector<lib_date::myDate>* holidays_for_pmt;
+            fin_curves::bs_leg dom_leg;
+            fin_curves::bs_leg for_leg;
+            bool is_dom_solved;
+            bool is_ccy1;
+            std::string zr_dcm;
+            int zr_type;
+            double yr_frac_last;
+            double yr_frac_fx;
+            double fx;
+            std::size_t iters_no;
+            fin_curves::calib_eq eq;
+
+            /**
+             * @brief Generate regular coupons of a leg up to a specified number of coupons, i.e. their dates, year fractions and projected forwards.
+             *
+             * @param leg Leg to be extended.
+             * @param cpns_no Number of regular coupons the leg should have.
+             * @param cal Payment calendar name; coupon dates are taken from schedules cached per thread, see fin_date::get_cpn_dates().
+             * @param dcm Day count method of coupon accruals.
+             */
+            void extend_leg(fin_curves::bs_leg& leg, const std::size_t& cpns_no, const std::string& cal, const std::string& dcm);
+
+            /**
+             * @brief Generate schedule of a swap of the strip; missing regular coupons are added to the legs.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @return fin_curves::bs_swp Swap schedule.
+             */
+            fin_curves::bs_swp get_swp(const std::string& tenor);
+
+            /**
+             * @brief Build calibration equation of a swap of the strip.
+             *
+             * @param swp Swap schedule.
+             * @param spread Basis spread paid on the domestic leg.
+             * @param pv_known Present value of the leg discounted by the known curve per unit of notional.
+             * @param pv_known_deriv Derivative of the present value of the leg discounted by the known curve with respect to the basis spread.
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq build_calib_eq(const fin_curves::bs_swp& swp, const double& spread, const double& pv_known, const double& pv_known_deriv) const;
+
+            /**
+             * @brief Calculate FX forward implied by a swap of the strip through covered interest parity.
+             *
+             * @param swp Swap schedule.
+             * @param df_spot Discount factor of the curve being bootstrapped as of spot date of its leg.
+             * @param df_end Discount factor of the curve being bootstrapped as of swap maturity.
+             */
+            void set_fx(const fin_curves::bs_swp& swp, const double& df_spot, const double& df_end);
+
+        public:
+            /**
+             * @brief Construct a new myBsSwpInstr object, i.e. an empty strip of cross-currency basis swaps.
+             *
+             * @param date Execution date from which swap maturities are derived using tenor information.
+             * @param generator Generator with definitions needed to evaluate cross-currency basis swaps.
+             * @param crv Zero rate curve to be bootstrapped; it discounts the leg of its currency.
+             * @param dom_prj_crv Zero rate curve projecting forwards of the domestic leg.
+             * @param for_prj_crv Zero rate curve projecting forwards of the foreign leg.
+             * @param oth_crv Zero rate curve discounting the leg of the other currency.
+             * @param fx_crv FX curve of the currency pair; nullptr => FX forwards implied by the solved nodes are not calculated.
+             * @param date_format Date format.
+             */
+            myBsSwpInstr(const std::string& date, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, const std::shared_ptr<fin_curves::myZeroRate>& dom_prj_crv, const std::shared_ptr<fin_curves::myZeroRate>& for_prj_crv, const std::shared_ptr<fin_curves::myZeroRate>& oth_crv, const std::shared_ptr<fin_curves::myFxCurve>& fx_crv = nullptr, std::string date_format = "yyyymmdd");
+
+            /**
+             * @brief Solve zero rate of the next swap of the strip using Newton-Raphson method with analytic derivative. Swaps have to be solved in the order of
+             * their tenors and nodes of the zero rate curve must not be modified between two calls except for adding new nodes.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @param spread Basis spread paid on the domestic leg.
+             * @param crv Zero rate curve being bootstrapped holding nodes solved so far; the swap maturity node follows its last node.
+             * @return std::tuple<double, double> Maturity year fraction and zero rate following convention of the zero rate curve.
+             */
+            std::tuple<double, double> solve(const std::string& tenor, const double& spread, const fin_curves::myZeroRate& crv);
+
+            /**
+             * @brief Get FX forward implied by the last solved swap through covered interest parity.
+             *
+             * @return std::tuple<double, double> Maturity year fraction following day count method of the FX curve and FX forward.
+             */
+            std::tuple<double, double> get_yr_frac_fx() const;
+
+            /**
+             * @brief Get number of Newton-Raphson iterations needed to solve the last swap.
+             *
+             * @return std::size_t Number of iterations.
+             */
+            std::size_t get_iters_no() const {return this->iters_no;};
+
+            /**
+             * @brief Get calibration equation of the last solved swap, i.e. present value of the leg discounted by the curve being bootstrapped minus present
+             * value of the other leg = 0; forwards of both legs are given by the projection curves.
+             *
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq() const {return this->eq;};
+
+            /**
+             * @brief Get calibration equation of any swap of the strip for a provided spread without solving it; regular coupons generated for the preceding
+             * swaps are reused.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @param spread Basis spread paid on the domestic leg.
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq(const std::string& tenor, const double& spread);
+
+            /**
+             * @brief Get year fraction of the curve node of any swap of the strip without solving it, i.e. maturity of the leg discounted by the curve being
+             * bootstrapped; regular coupons generated for the preceding swaps are reused.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @return double Year fraction of the curve node.
+             */
+            double get_yr_frac_node(const std::string& tenor);
+
+            /**
+             * @brief Get FX forward implied by any swap of the strip through covered interest parity using an already solved zero rate curve.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @param crv Zero rate curve holding the swap maturity node.
+             * @return std::tuple<double, double> Maturity year fraction following day count method of the FX curve and FX forward.
+             */
+            std::tuple<double, double> get_yr_frac_fx(const std::string& tenor, const fin_curves::myZeroRate& crv);
+    };
+}
@@ -0,0 +1,531 @@
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include "lib_dual.h"
+#include "fin_curves.h"
+#include "fin_calibration.h"
+
+fin_curves::myCalibration::myCalibration(const std::vector<double>& yr_fracs, const int& zr_type, const std::vector<fin_curves::calib_eq>& eqs)
+{
+    // store variables into the object
+    this->yr_fracs = yr_fracs;
+    this->zr_type = zr_type;
+    this->set_eqs(eqs);
+}
+
+fin_curves::myCalibration::myCalibration(const fin_curves::myZeroRate& crv, const std::vector<fin_curves::calib_eq>& eqs)
+{
+    // interpolations are evaluated without the curve; cubic spline weights of node zero rates are evaluated once by a copy of the curve, so that the curve
+    // itself is not changed
+    fin_curves::zr_interp_def interp_def = crv.get_def();
+    if (interp_def.zr_interp.compare("linear") == 0)
+        this->interp_tp = 0;
+    else if (interp_def.zr_interp.compare("cubic") == 0)
+        this->interp_tp = 1;
+    else if (interp_def.zr_interp.compare("log_linear") == 0)
+        this->interp_tp = 2;
+    else if (interp_def.zr_interp.compare("monotone_convex") == 0)
+        this->interp_tp = 3;
+    else
+        throw std::runtime_error((std::string)__func__ + ": '" + interp_def.zr_interp + "' interpolation of curve '" + crv.get_crv_nm() + "' is not supported by calibration!");
+    if (this->interp_tp == 1)
+        this->crv = std::make_shared<fin_curves::myZeroRate>(crv);
+
+    // store variables into the object
+    this->yr_fracs = crv.get_yr_fracs();
+    this->zr_type = interp_def.zr_type;
+    this->set_eqs(eqs);
+}
+
+// locate referenced year fractions and translate calibration equations into rows of the Jacobian
+void fin_curves::myCalibration::set_eqs(const std::vector<fin_curves::calib_eq>& eqs)
+{
+    // check that each node is determined by a single calibration equation
+    std::size_t nodes_no = this->yr_fracs.size();
+    if (nodes_no == 0)
+        throw std::runtime_error((std::string)__func__ + ": No curve nodes to be calibrated!");
+    if (nodes_no != eqs.size())
+        throw std::runtime_error((std::string)__func__ + ": Number of curve nodes differs from number of calibration equations!");
+    for (std::size_t idx = 1; idx < nodes_no; idx++)
+    {
+        if (this->yr_fracs[idx] <= this->yr_fracs[idx - 1])
+            throw std::runtime_error((std::string)__func__ + ": Year fractions of curve nodes are not sorted in ascending order!");
+    }
+    this->bandwidth = 0;
+    this->iters_no = 0;
+
+    // locate year fraction among curve nodes; each year fraction is located only once and shared by all equations; nodes_no as node index => discount
+    // factor is equal to one
+    std::map<double, std::size_t> pts;
+    auto get_pt = [&](const double& yr_frac) -> std::size_t
+    {
+        auto pt = pts.find(yr_frac);
+        if (pt != pts.end())
+            return pt->second;
+
+        std::size_t idx_lo = nodes_no;
+        std::size_t idx_hi = nodes_no;
+        double weight = 0.0;
+        if (yr_frac <= 0.0)
+            ;
+        else if (yr_frac <= this->yr_fracs[0])
+        {
+            idx_lo = 0;
+            idx_hi = 0;
+        }
+        else if (yr_frac >= this->yr_fracs[nodes_no - 1])
+        {
+            idx_lo = nodes_no - 1;
+            idx_hi = nodes_no - 1;
+        }
+        else
+        {
+            idx_hi = std::upper_bound(this->yr_fracs.begin(), this->yr_fracs.end(), yr_frac) - this->yr_fracs.begin();
+            idx_lo = idx_hi - 1;
+            weight = (yr_frac - this->yr_fracs[idx_lo]) / (this->yr_fracs[idx_hi] - this->yr_fracs[idx_lo]);
+        }
+
+        // discount factor within a cubic spline segment moves with all nodes, within a monotone convex segment with nodes of the neighbouring segments
+        // as well, since they shape instantaneous forwards of its ends
+        std::size_t col_lo = idx_lo;
+        std::size_t col_hi = idx_hi;
+        if ((this->interp_tp == 1) && (idx_lo != idx_hi))
+        {
+            col_lo = 0;
+            col_hi = nodes_no - 1;
+        }
+        else if ((this->interp_tp == 3) && (idx_lo != idx_hi))
+        {
+            col_lo = (idx_lo > 0) ? idx_lo - 1 : 0;
+            col_hi = std::min(nodes_no - 1, idx_hi + 1);
+        }
+
+        this->pts_yr_fracs.push_back(yr_frac);
+        this->pts_idxs_lo.push_back(idx_lo);
+        this->pts_idxs_hi.push_back(idx_hi);
+        this->pts_cols_lo.push_back(col_lo);
+        this->pts_cols_hi.push_back(col_hi);
+        this->pts_weights.push_back(weight);
+        pts[yr_frac] = this->pts_yr_fracs.size() - 1;
+        return this->pts_yr_fracs.size() - 1;
+    };
+
+    // translate equations into rows of the Jacobian and find out columns each row spans
+    for (std::size_t row = 0; row < nodes_no; row++)
+    {
+        const fin_curves::calib_eq& eq = eqs[row];
+        std::size_t col_lo = nodes_no;
+        std::size_t col_hi = 0;
+        auto update_cols = [&](const std::size_t& pt)
+        {
+            if (this->pts_idxs_lo[pt] == nodes_no)
+                return;
+            col_lo = std::min(col_lo, this->pts_cols_lo[pt]);
+            col_hi = std::max(col_hi, this->pts_cols_hi[pt]);
+        };
+
+        std::vector<std::tuple<double, std::size_t>> row_dfs;
+        for (const std::tuple<double, double>& df : eq.dfs)
+        {
+            std::size_t pt = get_pt(std::get<1>(df));
+            update_cols(pt);
+            row_dfs.push_back({std::get<0>(df), pt});
+        }
+
+        std::vector<std::tuple<double, std::size_t, std::size_t>> row_df_ratios;
+        for (const std::tuple<double, double, double>& df_ratio : eq.df_ratios)
+        {
+            std::size_t pt_num = get_pt(std::get<1>(df_ratio));
+            std::size_t pt_den = get_pt(std::get<2>(df_ratio));
+            update_cols(pt_num);
+            update_cols(pt_den);
+            row_df_ratios.push_back({std::get<0>(df_ratio), pt_num, pt_den});
+        }
+
+        // equation has to depend on its own node, otherwise the Jacobian is singular
+        if ((col_lo > row) || (col_hi < row))
+            throw std::runtime_error((std::string)__func__ + ": Calibration equation " + std::to_string(row) + " does not depend on its curve node!");
+
+        this->csts.push_back(eq.cst);
+        this->rows_dfs.push_back(row_dfs);
+        this->rows_df_ratios.push_back(row_df_ratios);
+        this->rows_lo.push_back(col_lo);
+        this->bandwidth = std::max(this->bandwidth, col_hi - row);
+    }
+
+    // derivatives of each discount factor are stored for the nodes it moves with
+    std::size_t pts_no = this->pts_yr_fracs.size();
+    this->pts_derivs_offset.assign(pts_no + 1, 0);
+    for (std::size_t pt = 0; pt < pts_no; pt++)
+    {
+        std::size_t cols_no = (this->pts_idxs_lo[pt] == nodes_no) ? 0 : this->pts_cols_hi[pt] - this->pts_cols_lo[pt] + 1;
+        this->pts_derivs_offset[pt + 1] = this->pts_derivs_offset[pt] + cols_no;
+    }
+
+    // zero rate interpolated linearly, by cubic spline or flat beyond the end nodes is a weighted sum of zero rates of the nodes; weights of cubic spline
+    // are the spline of unit zero rate of each node
+    this->pts_zr_weights.assign(this->pts_derivs_offset[pts_no], 0.0);
+    for (std::size_t pt = 0; pt < pts_no; pt++)
+    {
+        std::size_t idx_lo = this->pts_idxs_lo[pt];
+        std::size_t offset = this->pts_derivs_offset[pt];
+        if (idx_lo == nodes_no)
+            continue;
+        else if (idx_lo == this->pts_idxs_hi[pt])
+            this->pts_zr_weights[offset] = 1.0;
+        else if (this->interp_tp == 0)
+        {
+            this->pts_zr_weights[offset] = 1.0 - this->pts_weights[pt];
+            this->pts_zr_weights[offset + 1] = this->pts_weights[pt];
+        }
+    }
+    for (std::size_t col = 0; (this->interp_tp == 1) && (col < nodes_no); col++)
+    {
+        std::vector<double> zrs_unit(nodes_no, 0.0);
+        zrs_unit[col] = 1.0;
+        this->crv->load(this->crv->get_date(), this->yr_fracs, zrs_unit);
+        for (std::size_t pt = 0; pt < pts_no; pt++)
+        {
+            if ((this->pts_idxs_lo[pt] != nodes_no) && (this->pts_idxs_lo[pt] != this->pts_idxs_hi[pt]))
+                this->pts_zr_weights[this->pts_derivs_offset[pt] + col] = this->crv->get_zr(this->pts_yr_fracs[pt]);
+        }
+    }
+}
+
+// evaluate discount factors of all referenced year fractions and their derivatives
+void fin_curves::myCalibration::eval_dfs(const std::vector<double>& zrs, std::vector<double>& dfs, std::vector<double>& dfs_derivs) const
+{
+    std::size_t nodes_no = this->yr_fracs.size();
+    std::size_t pts_no = this->pts_yr_fracs.size();
+    dfs.assign(pts_no, 1.0);
+    dfs_derivs.assign(this->pts_derivs_offset[pts_no], 0.0);
+
+    // negative logarithm of node discount factor and its derivative with respect to zero rate of the node
+    auto get_log_df = [&](const std::size_t& idx) -> double {return -std::log(fin_curves::zr_to_df(zrs[idx], this->yr_fracs[idx], this->zr_type));};
+    auto get_log_df_deriv = [&](const std::size_t& idx) -> double {return (this->zr_type == 0) ? this->yr_fracs[idx] / (1.0 + zrs[idx]) : this->yr_fracs[idx];};
+
+    // monotone convex segment is shaped by the nodes its discount factors move with, i.e. at most four nodes seeded into lanes of dual numbers; each
+    // segment is evaluated only once
+    using dual_mc = lib_math::dual<4>;
+    std::vector<fin_curves::mc_seg<dual_mc>> mc_segs((this->interp_tp == 3) ? nodes_no - 1 : 0);
+    std::vector<bool> is_mc_seg(mc_segs.size(), false);
+    auto get_mc_log_df = [&](const std::size_t& idx, const std::size_t& col_lo) -> dual_mc
+    {
+        dual_mc log_df(get_log_df(idx));
+        log_df.grad[idx - col_lo] = get_log_df_deriv(idx);
+        return log_df;
+    };
+
+    for (std::size_t pt = 0; pt < pts_no; pt++)
+    {
+        std::size_t idx_lo = this->pts_idxs_lo[pt];
+        std::size_t idx_hi = this->pts_idxs_hi[pt];
+        if (idx_lo == nodes_no)
+            continue;
+
+        double yr_frac = this->pts_yr_fracs[pt];
+        std::size_t col_lo = this->pts_cols_lo[pt];
+        std::size_t cols_no = this->pts_cols_hi[pt] - col_lo + 1;
+        double* derivs = dfs_derivs.data() + this->pts_derivs_offset[pt];
+
+        // zero rates interpolated linearly, by cubic spline or flat beyond the end nodes
+        if ((this->interp_tp <= 1) || (idx_lo == idx_hi))
+        {
+            const double* weights = this->pts_zr_weights.data() + this->pts_derivs_offset[pt];
+            double zr = 0.0;
+            for (std::size_t col = 0; col < cols_no; col++)
+                zr += weights[col] * zrs[col_lo + col];
+            double df = fin_curves::zr_to_df(zr, yr_frac, this->zr_type);
+            double df_deriv = (this->zr_type == 0) ? -yr_frac * df / (1.0 + zr) : -yr_frac * df;
+
+            dfs[pt] = df;
+            for (std::size_t col = 0; col < cols_no; col++)
+                derivs[col] = df_deriv * weights[col];
+        }
+        // logarithms of discount factors interpolated linearly
+        else if (this->interp_tp == 2)
+        {
+            double weight = this->pts_weights[pt];
+            double df = std::exp(-(get_log_df(idx_lo) * (1.0 - weight) + get_log_df(idx_hi) * weight));
+
+            dfs[pt] = df;
+            derivs[0] = -df * (1.0 - weight) * get_log_df_deriv(idx_lo);
+            derivs[1] = -df * weight * get_log_df_deriv(idx_hi);
+        }
+        // monotone convex forwards
+        else
+        {
+            auto slope = [&](const std::size_t& idx) -> dual_mc
+            {
+                return (get_mc_log_df(idx + 1, col_lo) - get_mc_log_df(idx, col_lo)) / (this->yr_fracs[idx + 1] - this->yr_fracs[idx]);
+            };
+            if (!is_mc_seg[idx_lo])
+            {
+                dual_mc slope_seg = slope(idx_lo);
+                dual_mc g0 = fin_curves::get_mc_fwd<dual_mc>(this->yr_fracs, idx_lo, slope) - slope_seg;
+                dual_mc g1 = fin_curves::get_mc_fwd<dual_mc>(this->yr_fracs, idx_hi, slope) - slope_seg;
+                mc_segs[idx_lo] = fin_curves::get_mc_seg(g0, g1);
+                is_mc_seg[idx_lo] = true;
+            }
+
+            double d = yr_frac - this->yr_fracs[idx_lo];
+            double h = this->yr_fracs[idx_hi] - this->yr_fracs[idx_lo];
+            dual_mc log_df = get_mc_log_df(idx_lo, col_lo) + slope(idx_lo) * d + h * fin_curves::eval_mc_g_int(mc_segs[idx_lo], d / h);
+            double df = std::exp(-log_df.val);
+
+            dfs[pt] = df;
+            for (std::size_t col = 0; col < cols_no; col++)
+                derivs[col] = -df * log_df.grad[col];
+        }
+    }
+}
+
+// evaluate residuals of calibration equations
+std::vector<double> fin_curves::myCalibration::eval_residuals(const std::vector<double>& dfs) const
+{
+    std::vector<double> residuals = this->csts;
+    for (std::size_t row = 0; row < residuals.size(); row++)
+    {
+        for (const auto& [weight, pt] : this->rows_dfs[row])
+            residuals[row] += weight * dfs[pt];
+        for (const auto& [weight, pt_num, pt_den] : this->rows_df_ratios[row])
+            residuals[row] += weight * dfs[pt_num] / dfs[pt_den];
+    }
+
+    return residuals;
+}
+
+// get residuals of calibration equations
+std::vector<double> fin_curves::myCalibration::get_residuals(const std::vector<double>& zrs) const
+{
+    if (zrs.size() != this->yr_fracs.size())
+        throw std::runtime_error((std::string)__func__ + ": Number of zero rates differs from number of curve nodes!");
+
+    std::vector<double> dfs;
+    std::vector<double> dfs_derivs;
+    this->eval_dfs(zrs, dfs, dfs_derivs);
+    return this->eval_residuals(dfs);
+}
+
+// solve zero rates of all curve nodes
+std::vector<double> fin_curves::myCalibration::solve(const std::vector<double>& zrs_init, const double& tolerance, const std::size_t& iters_max)
+{
+    std::size_t nodes_no = this->yr_fracs.size();
+    if (zrs_init.size() != nodes_no)
+        throw std::runtime_error((std::string)__func__ + ": Number of zero rates differs from number of curve nodes!");
+
+    auto get_norm_max = [](const std::vector<double>& residuals) -> double
+    {
+        double norm = 0.0;
+        for (double residual : residuals)
+            norm = std::max(norm, std::abs(residual));
+        return norm;
+    };
+    auto get_norm_sq = [](const std::vector<double>& residuals) -> double
+    {
+        double norm = 0.0;
+        for (double residual : residuals)
+            norm += residual * residual;
+        return norm;
+    };
+
+    // row of the banded Jacobian spans columns from its first referenced node up to bandwidth nodes above the diagonal; fill-in of the elimination stays
+    // within the same columns
+    std::vector<std::size_t> rows_hi(nodes_no);
+    std::vector<std::size_t> rows_offset(nodes_no + 1, 0);
+    for (std::size_t row = 0; row < nodes_no; row++)
+    {
+        rows_hi[row] = std::min(nodes_no - 1, row + this->bandwidth);
+        rows_offset[row + 1] = rows_offset[row] + rows_hi[row] - this->rows_lo[row] + 1;
+    }
+    std::vector<double> jacobian(rows_offset[nodes_no]);
+    auto elem = [&](const std::size_t& row, const std::size_t& col) -> double& {return jacobian[rows_offset[row] + col - this->rows_lo[row]];};
+
+    std::vector<double> zrs = zrs_init;
+    std::vector<double> dfs;
+    std::vector<double> dfs_derivs;
+    this->eval_dfs(zrs, dfs, dfs_derivs);
+    std::vector<double> residuals = this->eval_residuals(dfs);
+
+    this->iters_no = 0;
+    while (get_norm_max(residuals) > tolerance)
+    {
+        this->iters_no++;
+        if (this->iters_no > iters_max)
+            throw std::runtime_error((std::string)__func__ + ": Calibration of curve nodes did not converge!");
+
+        // assemble Jacobian; discount factor moves only with the nodes of its interpolation stencil
+        std::fill(jacobian.begin(), jacobian.end(), 0.0);
+        auto add_derivs = [&](const std::size_t& row, const std::size_t& pt, const double& factor)
+        {
+            if (this->pts_idxs_lo[pt] == nodes_no)
+                return;
+            const double* derivs = dfs_derivs.data() + this->pts_derivs_offset[pt];
+            for (std::size_t col = this->pts_cols_lo[pt]; col <= this->pts_cols_hi[pt]; col++)
+                elem(row, col) += factor * derivs[col - this->pts_cols_lo[pt]];
+        };
+        for (std::size_t row = 0; row < nodes_no; row++)
+        {
+            for (const auto& [weight, pt] : this->rows_dfs[row])
+                add_derivs(row, pt, weight);
+            for (const auto& [weight, pt_num, pt_den] : this->rows_df_ratios[row])
+            {
+                add_derivs(row, pt_num, weight / dfs[pt_den]);
+                add_derivs(row, pt_den, -weight * dfs[pt_num] / (dfs[pt_den] * dfs[pt_den]));
+            }
+        }
+
+        // Gaussian elimination within the band; each equation depends mainly on its own node, so rows are not interchanged and a pivot negligible
+        // compared to the original row, i.e. a singular or nearly singular Jacobian, is reported instead
+        std::vector<double> step = residuals;
+        for (std::size_t row = 0; row < nodes_no; row++)
+        {
+            double row_max = 0.0;
+            for (std::size_t col = this->rows_lo[row]; col <= rows_hi[row]; col++)
+                row_max = std::max(row_max, std::abs(elem(row, col)));
+            for (std::size_t col = this->rows_lo[row]; col < row; col++)
+            {
+                double factor = elem(row, col) / elem(col, col);
+                if (factor == 0.0)
+                    continue;
+                for (std::size_t col_aux = col + 1; col_aux <= rows_hi[col]; col_aux++)
+                    elem(row, col_aux) -= factor * elem(col, col_aux);
+                step[row] -= factor * step[col];
+            }
+            if (!(std::abs(elem(row, row)) > 1e-10 * row_max))
+                throw std::runtime_error((std::string)__func__ + ": Jacobian of calibration equations is singular, pivot of curve node " + std::to_string(row) + " is negligible!");
+        }
+        for (std::size_t row = nodes_no; row-- > 0;)
+        {
+            for (std::size_t col = row + 1; col <= rows_hi[row]; col++)
+                step[row] -= elem(row, col) * step[col];
+            step[row] /= elem(row, row);
+        }
+
+        // Newton step is halved until sum of squared residuals decreases
+        double norm_sq = get_norm_sq(residuals);
+        double step_size = 1.0;
+        std::vector<double> zrs_new(nodes_no);
+        std::vector<double> residuals_new;
+        while (true)
+        {
+            for (std::size_t idx = 0; idx < nodes_no; idx++)
+                zrs_new[idx] = zrs[idx] - step_size * step[idx];
+            this->eval_dfs(zrs_new, dfs, dfs_derivs);
+            residuals_new = this->eval_residuals(dfs);
+            if (get_norm_sq(residuals_new) < norm_sq)
+                break;
+
+            step_size /= 2.0;
+            if (step_size < 1e-10)
+                throw std::runtime_error((std::string)__func__ + ": Calibration of curve nodes stalled before reaching required tolerance!");
+        }
+        zrs = zrs_new;
+        residuals = residuals_new;
+    }
+
+    // return calibrated zero rates
+    return zrs;
+}
+
+// solve zero rate of a single curve node as in sequential bootstrap
+double fin_curves::myCalibration::solve_node(const std::vector<double>& yr_fracs, const std::vector<double>& zrs, const std::size_t& idx, const int& zr_type, const std::string& zr_interp, const fin_curves::calib_eq& eq, const double& tolerance, const std::size_t& iters_max)
+{
+    if ((idx >= yr_fracs.size()) || (idx >= zrs.size()))
+        throw std::runtime_error((std::string)__func__ + ": Curve node " + std::to_string(idx) + " does not exist!");
+    bool is_log_linear = (zr_interp.compare("log_linear") == 0);
+    if (!is_log_linear && (zr_interp.compare("linear") != 0))
+        throw std::runtime_error((std::string)__func__ + ": '" + zr_interp + "' interpolation is not solved node by node!");
+
+    // zero rate as of a year fraction is expressed as zr_fixed + weight * zr_node, where zr_node is zero rate of the solved node; negative logarithm of
+    // log-linearly interpolated discount factor is expressed as log_df_fixed + weight * log_df_node instead
+    auto get_log_df = [&](const std::size_t& node_idx) -> double {return -std::log(fin_curves::zr_to_df(zrs[node_idx], yr_fracs[node_idx], zr_type));};
+    struct pt {double yr_frac; double zr_fixed; double weight; double log_df_fixed; bool is_log_df;};
+    auto get_pt = [&](const double& yr_frac) -> pt
+    {
+        if ((idx == 0) || (yr_frac >= yr_fracs[idx]))
+            return {yr_frac, 0.0, 1.0, 0.0, false};
+        if (yr_frac <= yr_fracs[0])
+            return {yr_frac, zrs[0], 0.0, 0.0, false};
+
+        std::size_t idx_hi = std::upper_bound(yr_fracs.begin(), yr_fracs.begin() + idx + 1, yr_frac) - yr_fracs.begin();
+        double weight = (yr_frac - yr_fracs[idx_hi - 1]) / (yr_fracs[idx_hi] - yr_fracs[idx_hi - 1]);
+        if (is_log_linear && (idx_hi == idx))
+            return {yr_frac, 0.0, weight, get_log_df(idx_hi - 1) * (1.0 - weight), true};
+        if (is_log_linear)
+            return {yr_frac, 0.0, 0.0, get_log_df(idx_hi - 1) + (get_log_df(idx_hi) - get_log_df(idx_hi - 1)) * weight, true};
+        if (idx_hi == idx)
+            return {yr_frac, zrs[idx_hi - 1] * (1.0 - weight), weight, 0.0, false};
+        return {yr_frac, zrs[idx_hi - 1] + (zrs[idx_hi] - zrs[idx_hi - 1]) * weight, 0.0, 0.0, false};
+    };
+
+    // discount factor and its derivative with respect to zero rate of the solved node
+    auto get_df_deriv = [&](const pt& point, const double& zr_node) -> std::tuple<double, double>
+    {
+        if (point.yr_frac <= 0.0)
+            return {1.0, 0.0};
+
+        if (point.is_log_df)
+        {
+            double yr_frac_node = yr_fracs[idx];
+            double log_df_node = (zr_type == 0) ? yr_frac_node * std::log1p(zr_node) : yr_frac_node * zr_node;
+            double log_df_node_deriv = (zr_type == 0) ? yr_frac_node / (1.0 + zr_node) : yr_frac_node;
+            double df = std::exp(-(point.log_df_fixed + point.weight * log_df_node));
+            return {df, -df * point.weight * log_df_node_deriv};
+        }
+
+        double zr = point.zr_fixed + point.weight * zr_node;
+        double df = fin_curves::zr_to_df(zr, point.yr_frac, zr_type);
+        double df_deriv = (zr_type == 0) ? -point.yr_frac * df / (1.0 + zr) * point.weight : -point.yr_frac * df * point.weight;
+        return {df, df_deriv};
+    };
+
+    // locate year fractions referenced by the equation only once
+    std::vector<std::tuple<double, pt>> dfs;
+    for (const auto& [weight, yr_frac] : eq.dfs)
+        dfs.push_back({weight, get_pt(yr_frac)});
+    std::vector<std::tuple<double, pt, pt>> df_ratios;
+    for (const auto& [weight, yr_frac_num, yr_frac_den] : eq.df_ratios)
+        df_ratios.push_back({weight, get_pt(yr_frac_num), get_pt(yr_frac_den)});
+
+    // solve zero rate of the node using Newton-Raphson method
+    double zr_node = zrs[idx];
+    std::size_t iters_no = 0;
+    while (true)
+    {
+        iters_no++;
+        if (iters_no > iters_max)
+            throw std::runtime_error((std::string)__func__ + ": Zero rate of curve node " + std::to_string(idx) + " did not converge!");
+
+        double residual = eq.cst;
+        double residual_deriv = 0.0;
+        for (const auto& [weight, point] : dfs)
+        {
+            auto [df, df_deriv] = get_df_deriv(point, zr_node);
+            residual += weight * df;
+            residual_deriv += weight * df_deriv;
+        }
+        for (const auto& [weight, point_num, point_den] : df_ratios)
+        {
+            auto [df_num, df_num_deriv] = get_df_deriv(point_num, zr_node);
+            auto [df_den, df_den_deriv] = get_df_deriv(point_den, zr_node);
+            residual += weight * df_num / df_den;
+            residual_deriv += weight * (df_num_deriv / df_den - df_num * df_den_deriv / (df_den * df_den));
+        }
+
+        // residual vanishing up to rounding ends the iteration as well, otherwise the step might oscillate around the solution
+        if (std::abs(residual) < 1e-15)
+            break;
+
+        double step = residual / residual_deriv;
+        zr_node -= step;
+        if (std::abs(step) < tolerance)
+            break;
+    }
+
+    return zr_node;
+}
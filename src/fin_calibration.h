@@ -0,0 +1,242 @@
+/** \example fin_calibration_examples.h
+ * @file fin_calibration.h
+ * @author Michal Mackanic
+ * @brief Calibrate all nodes of a zero rate curve simultaneously.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <cmath>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include "fin_curves.h"
+#include "fin_zerorate.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Calibration equation of a single instrument expressed through discount factors of the calibrated curve, i.e. residual
+     * cst + sum(weight * DF(yr_frac)) + sum(weight * DF(yr_frac_num) / DF(yr_frac_den)) which is zero for the market quote. Discount factors as of year
+     * fractions not following the execution date are equal to one. Derivatives of the constant and of the weights with respect to the market quote are
+     * kept alongside; derivative vectors are either empty, i.e. the weights do not depend on the quote, or as long as the respective weight vectors.
+     * Discount factors of a known discount curve folded into the constant and into the weights are kept as well, i.e. the constant includes
+     * sum(weight * DF_dsc(yr_frac)) over dsc_dfs and weight of the i-th ratio is factor * DF_dsc(yr_frac) of the i-th element of df_ratios_dsc; the
+     * latter is either empty or as long as df_ratios.
+     *
+     */
+    struct calib_eq
+    {
+        double cst = 0.0;
+        std::vector<std::tuple<double, double>> dfs;
+        std::vector<std::tuple<double, double, double>> df_ratios;
+        double cst_deriv = 0.0;
+        std::vector<double> dfs_derivs;
+        std::vector<double> df_ratios_derivs;
+        std::vector<std::tuple<double, double>> dsc_dfs;
+        std::vector<std::tuple<double, double>> df_ratios_dsc;
+    };
+
+    /**
+     * @brief Object calibrating zero rates of all curve nodes at once so that all calibration equations are met. Each equation references only a few nodes,
+     * so the Jacobian is stored in a banded form, i.e. each row spans columns from the first node it references up to a common number of nodes above the
+     * diagonal, and Newton steps are solved through Gaussian elimination within the band without interchanging rows; nearly singular Jacobian is reported.
+     * Steps not reducing the residuals are damped. Zero rates are linearly interpolated between nodes and flat beyond the first and the last node unless
+     * a zero rate curve is provided, in which case its interpolation is followed. Jacobian is analytic, each discount factor moving only with nodes of its
+     * interpolation stencil: zero rates of linear interpolation and cubic spline are weighted sums of node zero rates with weights evaluated once, i.e.
+     * all nodes for cubic spline, log-linear discount factors move with the two neighbouring nodes and monotone convex forwards are differentiated with
+     * respect to nodes of the neighbouring segments using dual numbers.
+     *
+     */
+    class myCalibration
+    {
+        private:
+            std::vector<double> yr_fracs;
+            int zr_type;
+            int interp_tp = 0;
+            std::shared_ptr<fin_curves::myZeroRate> crv;
+            std::vector<double> pts_yr_fracs;
+            std::vector<std::size_t> pts_idxs_lo;
+            std::vector<std::size_t> pts_idxs_hi;
+            std::vector<std::size_t> pts_cols_lo;
+            std::vector<std::size_t> pts_cols_hi;
+            std::vector<double> pts_weights;
+            std::vector<std::size_t> pts_derivs_offset;
+            std::vector<double> pts_zr_weights;
+            std::vector<double> csts;
+            std::vector<std::vector<std::tuple<double, std::size_t>>> rows_dfs;
+            std::vector<std::vector<std::tuple<double, std::size_t, std::size_t>>> rows_df_ratios;
+            std::vector<std::size_t> rows_lo;
+            std::size_t bandwidth;
+            std::size_t iters_no;
+
+            /**
+             * @brief Locate year fractions referenced by calibration equations among curve nodes and translate the equations into rows of the Jacobian.
+             *
+             * @param eqs Calibration equations.
+             */
+            void set_eqs(const std::vector<fin_curves::calib_eq>& eqs);
+
+            /**
+             * @brief Evaluate discount factors of all referenced year fractions and their derivatives with respect to zero rates of the nodes of their
+             * interpolation stencils.
+             *
+             * @param zrs Zero rates of curve nodes.
+             * @param dfs Discount factors.
+             * @param dfs_derivs Derivatives; derivatives of a discount factor start at its offset and follow the stencil nodes in ascending order.
+             */
+            void eval_dfs(const std::vector<double>& zrs, std::vector<double>& dfs, std::vector<double>& dfs_derivs) const;
+
+            /**
+             * @brief Evaluate residuals of calibration equations using already evaluated discount factors.
+             *
+             * @param dfs Discount factors of all referenced year fractions.
+             * @return std::vector<double> Residuals.
+             */
+            std::vector<double> eval_residuals(const std::vector<double>& dfs) const;
+
+        public:
+            /**
+             * @brief Construct a new myCalibration object. Year fractions referenced by calibration equations are located among curve nodes only once.
+             *
+             * @param yr_fracs Node year fractions sorted in ascending order; there must be as many nodes as calibration equations.
+             * @param zr_type Zero rate type, i.e. 0 => annual compounding, 1 => continuous compounding.
+             * @param eqs Calibration equations.
+             */
+            myCalibration(const std::vector<double>& yr_fracs, const int& zr_type, const std::vector<fin_curves::calib_eq>& eqs);
+
+            /**
+             * @brief Construct a new myCalibration object calibrating nodes of a zero rate curve under its own interpolation, e.g. cubic spline; the curve itself is
+             * not changed.
+             *
+             * @param crv Zero rate curve with nodes to be calibrated; there must be as many nodes as calibration equations.
+             * @param eqs Calibration equations.
+             */
+            myCalibration(const fin_curves::myZeroRate& crv, const std::vector<fin_curves::calib_eq>& eqs);
+
+            /**
+             * @brief Get residuals of calibration equations for provided zero rates of curve nodes.
+             *
+             * @param zrs Zero rates of curve nodes.
+             * @return std::vector<double> Residuals.
+             */
+            std::vector<double> get_residuals(const std::vector<double>& zrs) const;
+
+            /**
+             * @brief Solve zero rates of all curve nodes using Newton method. Starting from a curve close to the solution, e.g. curve of the previous business
+             * day, a few iterations are needed.
+             *
+             * @param zrs_init Initial zero rates of curve nodes.
+             * @param tolerance Maximum absolute residual of the solution.
+             * @param iters_max Maximum number of iterations.
+             * @return std::vector<double> Zero rates of curve nodes.
+             */
+            std::vector<double> solve(const std::vector<double>& zrs_init, const double& tolerance = 1e-13, const std::size_t& iters_max = 50);
+
+            /**
+             * @brief Get number of Newton iterations needed by the last solve.
+             *
+             * @return std::size_t Number of iterations.
+             */
+            std::size_t get_iters_no() const {return this->iters_no;};
+
+            /**
+             * @brief Solve zero rate of a single curve node as in sequential bootstrap, i.e. zero rates of the preceding nodes are fixed, zero rates between
+             * the last preceding node and the solved node are linearly interpolated, or logarithms of discount factors for log-linear interpolation, and zero
+             * rates beyond the solved node are flat; the following nodes are ignored.
+             *
+             * @param yr_fracs Node year fractions sorted in ascending order.
+             * @param zrs Zero rates of curve nodes; zero rate of the solved node is used as initial guess.
+             * @param idx Position index of the solved node.
+             * @param zr_type Zero rate type, i.e. 0 => annual compounding, 1 => continuous compounding.
+             * @param zr_interp Interpolation between the nodes, i.e. "linear" or "log_linear".
+             * @param eq Calibration equation of the solved node.
+             * @param tolerance Newton step below which the iteration stops.
+             * @param iters_max Maximum number of iterations.
+             * @return double Zero rate of the solved node.
+             */
+            static double solve_node(const std::vector<double>& yr_fracs, const std::vector<double>& zrs, const std::size_t& idx, const int& zr_type, const std::string& zr_interp, const fin_curves::calib_eq& eq, const double& tolerance = 1e-14, const std::size_t& iters_max = 50);
+
+            /**
+             * @brief Evaluate residual of calibration equation of a single curve node as in sequential bootstrap, i.e. zero rates, or logarithms of discount
+             * factors for log-linear interpolation, are linearly interpolated between the node and the preceding nodes and zero rates are flat beyond the node;
+             * the following nodes are ignored. Evaluated with dual numbers, the residual carries its gradient with respect to whatever the zero rates and the
+             * quote change are differentiated by.
+             *
+             * @tparam T Scalar type, e.g. double or lib_math::dual.
+             * @param yr_fracs Node year fractions sorted in ascending order.
+             * @param zrs Zero rates of curve nodes.
+             * @param idx Position index of the node.
+             * @param zr_type Zero rate type, i.e. 0 => annual compounding, 1 => continuous compounding.
+             * @param zr_interp Interpolation between the nodes, i.e. "linear" or "log_linear".
+             * @param eq Calibration equation of the node.
+             * @param quote_chg Change of the market quote of the node applied through quote derivatives of the equation.
+             * @param dsc_dfs_chg Changes of discount factors of the discount curve, i.e. one for each element of dsc_dfs followed by one for each element of
+             * df_ratios_dsc of the equation; empty => discount curve is held fixed.
+             * @return T Residual.
+             */
+            template<typename T>
+            static T eval_node_residual(const std::vector<double>& yr_fracs, const std::vector<T>& zrs, const std::size_t& idx, const int& zr_type, const std::string& zr_interp, const fin_curves::calib_eq& eq, const T& quote_chg, const std::vector<T>& dsc_dfs_chg = {})
+            {
+                // elementary functions of other scalar types are found through argument dependent lookup
+                using std::exp;
+                using std::log;
+
+                bool is_log_linear = (zr_interp.compare("log_linear") == 0);
+                auto get_df = [&](const double& yr_frac) -> T
+                {
+                    if (yr_frac <= 0.0)
+                        return T(1.0);
+                    if ((idx == 0) || (yr_frac >= yr_fracs[idx]))
+                        return fin_curves::zr_to_df(zrs[idx], yr_frac, zr_type);
+                    if (yr_frac <= yr_fracs[0])
+                        return fin_curves::zr_to_df(zrs[0], yr_frac, zr_type);
+
+                    std::size_t idx_hi = std::upper_bound(yr_fracs.begin(), yr_fracs.begin() + idx + 1, yr_frac) - yr_fracs.begin();
+                    double weight = (yr_frac - yr_fracs[idx_hi - 1]) / (yr_fracs[idx_hi] - yr_fracs[idx_hi - 1]);
+                    if (is_log_linear)
+                    {
+                        T log_df_lo = -log(fin_curves::zr_to_df(zrs[idx_hi - 1], yr_fracs[idx_hi - 1], zr_type));
+                        T log_df_hi = -log(fin_curves::zr_to_df(zrs[idx_hi], yr_fracs[idx_hi], zr_type));
+                        return exp(-(log_df_lo + (log_df_hi - log_df_lo) * weight));
+                    }
+                    return fin_curves::zr_to_df(zrs[idx_hi - 1] + (zrs[idx_hi] - zrs[idx_hi - 1]) * weight, yr_frac, zr_type);
+                };
+
+                // changes of discount factors of the discount curve enter through the constant and through the weights of the ratios
+                bool is_dsc_chg = (dsc_dfs_chg.size() > 0);
+                if (is_dsc_chg && (dsc_dfs_chg.size() != eq.dsc_dfs.size() + eq.df_ratios_dsc.size()))
+                    throw std::runtime_error((std::string)__func__ + ": Number of discount factor changes does not match the calibration equation!");
+
+                T residual = T(eq.cst) + quote_chg * eq.cst_deriv;
+                if (is_dsc_chg)
+                {
+                    for (std::size_t pos = 0; pos < eq.dsc_dfs.size(); pos++)
+                        residual += dsc_dfs_chg[pos] * std::get<0>(eq.dsc_dfs[pos]);
+                }
+                for (std::size_t pos = 0; pos < eq.dfs.size(); pos++)
+                {
+                    const auto& [weight, yr_frac] = eq.dfs[pos];
+                    T weight_chg = (eq.dfs_derivs.size() == 0) ? T(weight) : weight + quote_chg * eq.dfs_derivs[pos];
+                    residual += weight_chg * get_df(yr_frac);
+                }
+                for (std::size_t pos = 0; pos < eq.df_ratios.size(); pos++)
+                {
+                    const auto& [weight, yr_frac_num, yr_frac_den] = eq.df_ratios[pos];
+                    T weight_chg = (eq.df_ratios_derivs.size() == 0) ? T(weight) : weight + quote_chg * eq.df_ratios_derivs[pos];
+                    if (is_dsc_chg && (eq.df_ratios_dsc.size() > 0))
+                        weight_chg += dsc_dfs_chg[eq.dsc_dfs.size() + pos] * std::get<0>(eq.df_ratios_dsc[pos]);
+                    residual += weight_chg * get_df(yr_frac_num) / get_df(yr_frac_den);
+                }
+                return residual;
+            }
+    };
+}
@@ -0,0 +1,362 @@
+/** \example fin_compcurve_examples.h
+ * @file fin_compcurve.h
+ * @author Michal Mackanic
+ * @brief Composite zero rate curves built lazily on top of zero rate curves, e.g. base curve plus spread, shifted base curve or weighted blend of curves.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include "fin_curves.h"
+#include "fin_zerorate.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Number of zero rates composite curves evaluate at once into a buffer on stack, so that batch queries do not allocate memory.
+     *
+     */
+    constexpr std::size_t comp_chunk_size = 64;
+
+    /**
+     * @brief View of a zero rate curve to be used within composite curves. The view only shares the curve, i.e. no curve nodes are copied; zero rates and
+     * discount factors are evaluated by the curve itself.
+     *
+     */
+    class myCurveView
+    {
+        private:
+            std::shared_ptr<const fin_curves::myZeroRate> crv;
+            unsigned short zr_type;
+
+        public:
+            /**
+             * @brief Construct a new myCurveView object.
+             *
+             * @param crv Zero rate curve; it should be frozen, see myZeroRate::freeze(), or not changed while the view is in use.
+             */
+            myCurveView(const std::shared_ptr<const fin_curves::myZeroRate>& crv) : crv(crv)
+            {
+                if (crv == nullptr)
+                    throw std::runtime_error((std::string)__func__ + ": Zero rate curve is missing!");
+                this->zr_type = crv->get_def().zr_type;
+            };
+
+            /**
+             * @brief Get zero rate type of the curve, see fin_curves::zr_to_df().
+             *
+             * @return unsigned short Zero rate type.
+             */
+            unsigned short get_zr_type() const {return this->zr_type;};
+
+            /**
+             * @brief Get zero rate for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @return double Zero rate.
+             */
+            double get_zr(const double& yr_frac) const {return this->crv->get_zr(yr_frac);};
+
+            /**
+             * @brief Get zero rates for an array of year fractions.
+             *
+             * @param yr_fracs Array of year fractions.
+             * @param zrs Array the zero rates are written into; it must hold at least size elements. It might be the year fractions array itself.
+             * @param size Number of year fractions.
+             */
+            void get_zrs(const double* yr_fracs, double* zrs, const std::size_t& size) const {this->crv->get_zrs(yr_fracs, zrs, size);};
+    };
+
+    /**
+     * @brief Base curve plus spread curve, e.g. credit spread curve over a risk-free curve. Zero rates of both curves are added, so both curves must be of
+     * the same zero rate type.
+     *
+     * @tparam crv_tp Type of the base curve, i.e. myCurveView or another composite curve.
+     * @tparam sprd_tp Type of the spread curve, i.e. myCurveView or another composite curve.
+     */
+    template<typename crv_tp, typename sprd_tp>
+    class mySpreadCurve
+    {
+        private:
+            crv_tp crv;
+            sprd_tp sprd;
+
+        public:
+            /**
+             * @brief Construct a new mySpreadCurve object.
+             *
+             * @param crv Base curve.
+             * @param sprd Spread curve; its zero rate type must be the same as the one of the base curve.
+             */
+            mySpreadCurve(const crv_tp& crv, const sprd_tp& sprd) : crv(crv), sprd(sprd)
+            {
+                if (crv.get_zr_type() != sprd.get_zr_type())
+                    throw std::runtime_error((std::string)__func__ + ": Zero rate types of base curve and spread curve differ!");
+            };
+
+            /**
+             * @brief Get zero rate type of the composite curve, i.e. of both curves.
+             *
+             * @return unsigned short Zero rate type.
+             */
+            unsigned short get_zr_type() const {return this->crv.get_zr_type();};
+
+            /**
+             * @brief Get zero rate for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @return double Zero rate.
+             */
+            double get_zr(const double& yr_frac) const {return this->crv.get_zr(yr_frac) + this->sprd.get_zr(yr_frac);};
+
+            /**
+             * @brief Get zero rates for an array of year fractions.
+             *
+             * @param yr_fracs Array of year fractions.
+             * @param zrs Array the zero rates are written into; it must hold at least size elements. It might be the year fractions array itself.
+             * @param size Number of year fractions.
+             */
+            void get_zrs(const double* yr_fracs, double* zrs, const std::size_t& size) const
+            {
+                // year fractions are read again by the spread curve, so they are copied first if the zero rates overwrite them
+                if (std::less<const double*>()(zrs, yr_fracs + size) && std::less<const double*>()(yr_fracs, zrs + size))
+                {
+                    std::vector<double> yr_fracs_aux(yr_fracs, yr_fracs + size);
+                    this->get_zrs(yr_fracs_aux.data(), zrs, size);
+                    return;
+                }
+
+                // base zero rates are written into the output array, spreads are added chunk by chunk
+                std::array<double, fin_curves::comp_chunk_size> sprds;
+                this->crv.get_zrs(yr_fracs, zrs, size);
+                for (std::size_t pos_begin = 0; pos_begin < size; pos_begin += sprds.size())
+                {
+                    std::size_t chunk_size = std::min(sprds.size(), size - pos_begin);
+                    this->sprd.get_zrs(yr_fracs + pos_begin, sprds.data(), chunk_size);
+                    for (std::size_t pos = 0; pos < chunk_size; pos++)
+                        zrs[pos_begin + pos] += sprds[pos];
+                }
+            };
+    };
+
+    /**
+     * @brief Base curve shifted in parallel, e.g. +1bp scenario. The shift is added to zero rates of the base curve.
+     *
+     * @tparam crv_tp Type of the base curve, i.e. myCurveView or another composite curve.
+     */
+    template<typename crv_tp>
+    class myShiftCurve
+    {
+        private:
+            crv_tp crv;
+            double shift;
+
+        public:
+            /**
+             * @brief Construct a new myShiftCurve object.
+             *
+             * @param crv Base curve.
+             * @param shift Parallel shift of zero rates, e.g. 0.0001 for +1bp.
+             */
+            myShiftCurve(const crv_tp& crv, const double& shift) : crv(crv), shift(shift) {};
+
+            /**
+             * @brief Get zero rate type of the base curve.
+             *
+             * @return unsigned short Zero rate type.
+             */
+            unsigned short get_zr_type() const {return this->crv.get_zr_type();};
+
+            /**
+             * @brief Get zero rate for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @return double Zero rate.
+             */
+            double get_zr(const double& yr_frac) const {return this->crv.get_zr(yr_frac) + this->shift;};
+
+            /**
+             * @brief Get zero rates for an array of year fractions.
+             *
+             * @param yr_fracs Array of year fractions.
+             * @param zrs Array the zero rates are written into; it must hold at least size elements. It might be the year fractions array itself.
+             * @param size Number of year fractions.
+             */
+            void get_zrs(const double* yr_fracs, double* zrs, const std::size_t& size) const
+            {
+                this->crv.get_zrs(yr_fracs, zrs, size);
+                for (std::size_t pos = 0; pos < size; pos++)
+                    zrs[pos] += this->shift;
+            };
+    };
+
+    /**
+     * @brief Weighted blend of two curves, i.e. weight * zero rate of the first curve + (1 - weight) * zero rate of the second curve; both curves must be
+     * of the same zero rate type.
+     *
+     * @tparam crv1_tp Type of the first curve, i.e. myCurveView or another composite curve.
+     * @tparam crv2_tp Type of the second curve, i.e. myCurveView or another composite curve.
+     */
+    template<typename crv1_tp, typename crv2_tp>
+    class myBlendCurve
+    {
+        private:
+            crv1_tp crv1;
+            crv2_tp crv2;
+            double weight;
+
+        public:
+            /**
+             * @brief Construct a new myBlendCurve object.
+             *
+             * @param crv1 The first curve.
+             * @param crv2 The second curve; its zero rate type must be the same as the one of the first curve.
+             * @param weight Weight of the first curve.
+             */
+            myBlendCurve(const crv1_tp& crv1, const crv2_tp& crv2, const double& weight) : crv1(crv1), crv2(crv2), weight(weight)
+            {
+                if (crv1.get_zr_type() != crv2.get_zr_type())
+                    throw std::runtime_error((std::string)__func__ + ": Zero rate types of blended curves differ!");
+            };
+
+            /**
+             * @brief Get zero rate type of the composite curve, i.e. of both curves.
+             *
+             * @return unsigned short Zero rate type.
+             */
+            unsigned short get_zr_type() const {return this->crv1.get_zr_type();};
+
+            /**
+             * @brief Get zero rate for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @return double Zero rate.
+             */
+            double get_zr(const double& yr_frac) const {return this->weight * this->crv1.get_zr(yr_frac) + (1.0 - this->weight) * this->crv2.get_zr(yr_frac);};
+
+            /**
+             * @brief Get zero rates for an array of year fractions.
+             *
+             * @param yr_fracs Array of year fractions.
+             * @param zrs Array the zero rates are written into; it must hold at least size elements. It might be the year fractions array itself.
+             * @param size Number of year fractions.
+             */
+            void get_zrs(const double* yr_fracs, double* zrs, const std::size_t& size) const
+            {
+                // year fractions are read again by the second curve, so they are copied first if the zero rates overwrite them
+                if (std::less<const double*>()(zrs, yr_fracs + size) && std::less<const double*>()(yr_fracs, zrs + size))
+                {
+                    std::vector<double> yr_fracs_aux(yr_fracs, yr_fracs + size);
+                    this->get_zrs(yr_fracs_aux.data(), zrs, size);
+                    return;
+                }
+
+                // zero rates of the first curve are written into the output array, the second curve is blended in chunk by chunk
+                std::array<double, fin_curves::comp_chunk_size> zrs2;
+                this->crv1.get_zrs(yr_fracs, zrs, size);
+                for (std::size_t pos_begin = 0; pos_begin < size; pos_begin += zrs2.size())
+                {
+                    std::size_t chunk_size = std::min(zrs2.size(), size - pos_begin);
+                    this->crv2.get_zrs(yr_fracs + pos_begin, zrs2.data(), chunk_size);
+                    for (std::size_t pos = 0; pos < chunk_size; pos++)
+                        zrs[pos_begin + pos] = this->weight * zrs[pos_begin + pos] + (1.0 - this->weight) * zrs2[pos];
+                }
+            };
+    };
+
+    /**
+     * @brief Get discount factor of a curve for a year fraction; zero rate is converted following zero rate type of the curve.
+     *
+     * @tparam crv_tp Type of the curve, i.e. myCurveView or a composite curve.
+     * @param crv Curve.
+     * @param yr_frac Year fraction.
+     * @return double Discount factor.
+     */
+    template<typename crv_tp>
+    double get_df(const crv_tp& crv, const double& yr_frac)
+    {
+        return fin_curves::zr_to_df(crv.get_zr(yr_frac), yr_frac, crv.get_zr_type());
+    }
+
+    /**
+     * @brief Get discount factors of a curve for an array of year fractions.
+     *
+     * @tparam crv_tp Type of the curve, i.e. myCurveView or a composite curve.
+     * @param crv Curve.
+     * @param yr_fracs Array of year fractions.
+     * @param dfs Array the discount factors are written into; it must hold at least size elements. It might be the year fractions array itself.
+     * @param size Number of year fractions.
+     */
+    template<typename crv_tp>
+    void get_dfs(const crv_tp& crv, const double* yr_fracs, double* dfs, const std::size_t& size)
+    {
+        // year fractions are read again by the conversion, so they are copied first if the discount factors overwrite them
+        if (std::less<const double*>()(dfs, yr_fracs + size) && std::less<const double*>()(yr_fracs, dfs + size))
+        {
+            std::vector<double> yr_fracs_aux(yr_fracs, yr_fracs + size);
+            fin_curves::get_dfs(crv, yr_fracs_aux.data(), dfs, size);
+            return;
+        }
+
+        crv.get_zrs(yr_fracs, dfs, size);
+        unsigned short zr_type = crv.get_zr_type();
+        for (std::size_t pos = 0; pos < size; pos++)
+            dfs[pos] = fin_curves::zr_to_df(dfs[pos], yr_fracs[pos], zr_type);
+    }
+
+    /**
+     * @brief Compose base curve plus spread curve.
+     *
+     * @tparam crv_tp Type of the base curve.
+     * @tparam sprd_tp Type of the spread curve.
+     * @param crv Base curve.
+     * @param sprd Spread curve.
+     * @return fin_curves::mySpreadCurve<crv_tp, sprd_tp> Composite curve.
+     */
+    template<typename crv_tp, typename sprd_tp>
+    fin_curves::mySpreadCurve<crv_tp, sprd_tp> add_sprd(const crv_tp& crv, const sprd_tp& sprd)
+    {
+        return fin_curves::mySpreadCurve<crv_tp, sprd_tp>(crv, sprd);
+    }
+
+    /**
+     * @brief Compose base curve shifted in parallel.
+     *
+     * @tparam crv_tp Type of the base curve.
+     * @param crv Base curve.
+     * @param shift Parallel shift of zero rates.
+     * @return fin_curves::myShiftCurve<crv_tp> Composite curve.
+     */
+    template<typename crv_tp>
+    fin_curves::myShiftCurve<crv_tp> add_shift(const crv_tp& crv, const double& shift)
+    {
+        return fin_curves::myShiftCurve<crv_tp>(crv, shift);
+    }
+
+    /**
+     * @brief Compose weighted blend of two curves.
+     *
+     * @tparam crv1_tp Type of the first curve.
+     * @tparam crv2_tp Type of the second curve.
+     * @param crv1 The first curve.
+     * @param crv2 The second curve.
+     * @param weight Weight of the first curve.
+     * @return fin_curves::myBlendCurve<crv1_tp, crv2_tp> Composite curve.
+     */
+    template<typename crv1_tp, typename crv2_tp>
+    fin_curves::myBlendCurve<crv1_tp, crv2_tp> blend(const crv1_tp& crv1, const crv2_tp& crv2, const double& weight)
+    {
+        return fin_curves::myBlendCurve<crv1_tp, crv2_tp>(crv1, crv2, weight);
+    }
+}
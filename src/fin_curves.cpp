@@ -6,55 +6,21 @@
 #include "fin_date.h"
 #include "fin_curves.h"
 
-double fin_curves::zr_to_df(const double& zr, const double& yr_frac, const unsigned short type)
-{
-    // df = 1 / (1 + zr) ^ yr_frac
-    if (type == 0)
-    {
-        return 1.0 / std::pow(1 + zr, yr_frac); 
-    }
-    // df = exp(-zr * yr_frac)
-    else if (type == 1)
-    {
-        return std::exp(-zr * yr_frac);
-    }
-    // unsupported conversion type
-    else
-        throw std::runtime_error((std::string)__func__ + ": '" + std::to_string(type) + "' is not a supported conversion type!");
-}
-
 std::vector<double> fin_curves::zr_to_df(const std::vector<double>& zrs, const std::vector<double>& yr_fracs, const unsigned short type)
 {
-    // vector of zero rates
+    // vector of discount factors
     std::vector<double> dfs;
 
     // go zero rate by zero rate
     for (std::size_t idx = 0; idx < zrs.size(); idx++)
     {
-        dfs.push_back(df_to_zr(zrs[idx], yr_fracs[idx], type));
+        dfs.push_back(zr_to_df(zrs[idx], yr_fracs[idx], type));
     }
 
-    // return vector of zero rates
+    // return vector of discount factors
     return dfs;
 }
 
-double fin_curves::df_to_zr(const double& df, const double& yr_frac, const unsigned short type)
-{
-    // df = 1 / (1 + zr) ^ yr_frac
-    if (type == 0)
-    {
-        return std::pow(df, -1.0 / yr_frac) - 1.0;
-    }
-    // df = exp(-zr * yr_frac)
-    else if (type == 1)
-    {
-        return -1.0 * std::log(df) / yr_frac;
-    }
-    // unsupported conversion type
-    else
-        throw std::runtime_error((std::string)__func__ + ": '" + std::to_string(type) + "' is not a supported conversion type!");
-}
-
 std::vector<double> fin_curves::df_to_zr(const std::vector<double>& dfs, const std::vector<double>& yr_fracs, const unsigned short type)
 {
     // vector of zero rates
@@ -105,7 +71,9 @@ std::tuple<std::vector<double>, std::vector<double>> fin_curves::interp_rate(con
             yr_fracs_interp.push_back(*yr_fracs[idx]);
             double rate;
             if (interp_tp.compare("linear") == 0)
-                rate = lib_math::lin_interp1d(yr_fracs_no_missing, rates_no_missing, std::vector<double>(*yr_fracs[idx]), false)[0]; // false => we do not extrapolate
+                rate = lib_math::lin_interp1d(yr_fracs_no_missing, rates_no_missing, std::vector<double>({*yr_fracs[idx]}), false)[0]; // false => we do not extrapolate
+            else if (interp_tp.compare("cubic") == 0)
+                rate = lib_math::cubic_interp1d(yr_fracs_no_missing, rates_no_missing, std::vector<double>({*yr_fracs[idx]}), false)[0];
             else
                 throw std::runtime_error((std::string)__func__ + ": '" + interp_tp + "' is not a supported interpolation!");
             rates_interp.push_back(rate);
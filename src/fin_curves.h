@@ -69,6 +69,9 @@ int main()
 #include <vector>
 #include <map>
 #include <memory>
+#include <cmath>
+#include <string>
+#include <stdexcept>
 #include "lib_date.h"
 #include "fin_generators.h"
 
@@ -80,9 +83,30 @@ namespace fin_curves
      * @param zr Zero rate.
      * @param yr_frac Year fraction, which is used to convert zero rate into discount factor.
      * @param type Type of conversion. \n 0 => df = 1 / (1 + zr) ^ yr_frac \n 1 => df = exp(-zr * yr_frac)
-     * @return double Discount factor.
+     * @tparam T Scalar type, e.g. double or lib_math::dual.
+     * @return T Discount factor.
      */
-    double zr_to_df(const double& zr, const double& yr_frac, const unsigned short type = 0);
+    template<typename T>
+    T zr_to_df(const T& zr, const double& yr_frac, const unsigned short type = 0)
+    {
+        // elementary functions of other scalar types are found through argument dependent lookup
+        using std::pow;
+        using std::exp;
+
+        // df = 1 / (1 + zr) ^ yr_frac
+        if (type == 0)
+        {
+            return 1.0 / pow(1 + zr, yr_frac);
+        }
+        // df = exp(-zr * yr_frac)
+        else if (type == 1)
+        {
+            return exp(-zr * yr_frac);
+        }
+        // unsupported conversion type
+        else
+            throw std::runtime_error((std::string)__func__ + ": '" + std::to_string(type) + "' is not a supported conversion type!");
+    }
 
     /**
      * @brief Convert zero rates into discount factors.
@@ -100,9 +124,30 @@ namespace fin_curves
      * @param df Discount factor.
      * @param yr_frac Year fraction, which is used to convert discount factor into zero rate.
      * @param type Type of conversion. \n 0 => df = 1 / (1 + zr) ^ yr_frac \n 1 => df = exp(-zr * yr_frac)
-     * @return double Zero rate.
+     * @tparam T Scalar type, e.g. double or lib_math::dual.
+     * @return T Zero rate.
      */
-    double df_to_zr(const double& df, const double& yr_frac, const unsigned short type = 0);
+    template<typename T>
+    T df_to_zr(const T& df, const double& yr_frac, const unsigned short type = 0)
+    {
+        // elementary functions of other scalar types are found through argument dependent lookup
+        using std::pow;
+        using std::log;
+
+        // df = 1 / (1 + zr) ^ yr_frac
+        if (type == 0)
+        {
+            return pow(df, -1.0 / yr_frac) - 1.0;
+        }
+        // df = exp(-zr * yr_frac)
+        else if (type == 1)
+        {
+            return -1.0 * log(df) / yr_frac;
+        }
+        // unsupported conversion type
+        else
+            throw std::runtime_error((std::string)__func__ + ": '" + std::to_string(type) + "' is not a supported conversion type!");
+    }
 
     /**
      * @brief Convert discount factors into zero rates.
@@ -119,7 +164,7 @@ namespace fin_curves
      * 
      * @param yr_fracs Vector of year fractions.
      * @param zrs Vector of zero rates.
-     * @param interp_tp Interpolation type; currently the only supported type is linear interpolation.
+     * @param interp_tp Interpolation type, i.e. "linear" or "cubic" (natural cubic spline).
      * @return std::tuple<double, double> Vector of year fractions and zero rates with missing zero rates being interpolated.
      */
     std::tuple<std::vector<double>, std::vector<double>> interp_rate(const std::vector<std::shared_ptr<double>>& yr_fracs, const std::vector<std::shared_ptr<double>>& zrs, const std::string& interp_tp = "linear");
@@ -9,7 +9,7 @@ fin_curves::myDepoInstr::myDepoInstr(const std::string& date, const std::string&
 {
 
     // check that the generator is depo
-    if (generator->instr_tp.compare("depo") == 1)
+    if (generator->instr_tp.compare("depo") != 0)
         throw std::runtime_error((std::string)__func__ + ": Instrument '" + generator->instr_nm + "' is not a deposit!");
 
     // store par rate
@@ -37,17 +37,20 @@ fin_curves::myDepoInstr::myDepoInstr(const std::string& date, const std::string&
     // determine auxiliary discount factor
     std::size_t idx;
     double df_aux;
+    double yr_frac_aux = 0.0;
     if (tenor.compare("ON") == 0)
         df_aux = 1.0;
     else if (tenor.compare("TN") == 0)
     {
         idx = 0;
         df_aux = crv.get_df(idx);
+        yr_frac_aux = crv.get_yr_frac(idx);
     }
     else
     {
         idx = 1;
         df_aux = crv.get_df(idx);
+        yr_frac_aux = crv.get_yr_frac(idx);
     }
 
     // calculate year fraction for interest period
@@ -59,8 +62,13 @@ fin_curves::myDepoInstr::myDepoInstr(const std::string& date, const std::string&
     // calculate discount factor
     this->df = 1.0 / (1.0 + this->par_rate * this->yr_frac_int) * df_aux;
 
-    // calculate year fraction for payment period
-    this->yr_frac_pmt = fin_date::day_count_method(lib_date::myDate(date, date_format), date_end, generator->instr_def.depo.dcm);
+    // calculate year fraction for payment period following day count method of the underlying zero rate curve
+    this->yr_frac_pmt = fin_date::day_count_method(lib_date::myDate(date, date_format), date_end, crv.get_def().zr_dcm);
+
+    // calibration equation
+    this->eq.dfs.push_back({1.0 + this->par_rate * this->yr_frac_int, this->yr_frac_pmt});
+    this->eq.dfs.push_back({-1.0, yr_frac_aux});
+    this->eq.dfs_derivs = {this->yr_frac_int, 0.0};
 
     // convert discount factor into zero rate following convention of the underlying zero rate curve
     double zr = fin_curves::df_to_zr(this->df, this->yr_frac_pmt, crv.get_def().zr_type);
@@ -18,6 +18,7 @@
 #include "lib_date.h"
 #include "fin_zerorate.h"
 #include "fin_generators.h"
+#include "fin_calibration.h"
 
 namespace fin_curves
 {
@@ -32,6 +33,7 @@ namespace fin_curves
             double yr_frac_pmt;
             double par_rate;
             double df;
+            fin_curves::calib_eq eq;
 
         public:
             /**
@@ -45,5 +47,12 @@ namespace fin_curves
              * @param date_format Date format.
              */
             myDepoInstr(const std::string& date_exec, const std::string& tenor, const double& par_rate, const std::shared_ptr<fin_curves::generator>& generator, fin_curves::myZeroRate& crv, std::string date_format = "yyyymmdd");
+
+            /**
+             * @brief Get calibration equation of the depo, i.e. DF(maturity) * (1 + par rate * accrual year fraction) - DF(start) = 0.
+             * 
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq() const {return this->eq;};
     };
 }
\ No newline at end of file
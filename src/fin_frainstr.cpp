@@ -0,0 +1,93 @@
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include "fin_date.h"
+#include "fin_curves.h"
+#include "fin_zerorate.h"
+#include "fin_frainstr.h"
+
+fin_curves::myFraInstr::myFraInstr(const std::string& date, const std::string& tenor, const double& par_rate, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, std::string date_format)
+{
+    // check that the generator is FRA
+    if (generator->instr_tp.compare("fra") != 0)
+        throw std::runtime_error((std::string)__func__ + ": Instrument '" + generator->instr_nm + "' is not a FRA!");
+
+    // store par rate
+    this->par_rate = par_rate;
+
+    // get fixing and payment calendars
+    lib_date::myDate date_exec = lib_date::myDate(date, date_format);
+    std::size_t year_start = date_exec.get_year();
+    const std::vector<lib_date::myDate>& holidays_fix = fin_date::get_holidays(generator->instr_def.fra.cal_fix, year_start, year_start + 100);
+    const std::vector<lib_date::myDate>& holidays_pmt = fin_date::get_holidays(generator->instr_def.fra.cal_pmt, year_start, year_start + 100);
+
+    // determine spot date using fixing calendar
+    lib_date::myDate date_spot = date_exec;
+    if (generator->instr_def.fra.days_shift > 0)
+        date_spot.add_working_days(holidays_fix, generator->instr_def.fra.days_shift);
+
+    // FRA starts one period before its maturity, e.g. 4M FRA on 3M period starts in 1M
+    std::tuple<int, std::string> freq_end = fin_date::decompose_freq(tenor);
+    std::tuple<int, std::string> freq_begin = fin_date::combine_freqs(freq_end, fin_date::decompose_freq(generator->instr_def.fra.period), "-");
+    if (std::get<0>(freq_begin) < 0)
+        throw std::runtime_error((std::string)__func__ + ": FRA tenor '" + tenor + "' is shorter than FRA period '" + generator->instr_def.fra.period + "'!");
+
+    // determine FRA start and end date using payment calendar
+    lib_date::myDate date_begin = date_spot;
+    if (std::get<0>(freq_begin) > 0)
+        date_begin.add(fin_date::compose_freq(freq_begin));
+    fin_date::date_rolling(date_begin, holidays_pmt, generator->instr_def.fra.drm);
+
+    lib_date::myDate date_end = date_spot;
+    date_end.add(fin_date::compose_freq(freq_end));
+    fin_date::date_rolling(date_end, holidays_pmt, generator->instr_def.fra.drm);
+
+    // determine discount factor as of FRA start date using the underlying zero rate curve
+    std::string zr_dcm = crv.get_def().zr_dcm;
+    double df_begin = 1.0;
+    double yr_frac_begin = 0.0;
+    if (date_begin.get_days_no() > date_exec.get_days_no())
+    {
+        yr_frac_begin = fin_date::day_count_method(date_exec, date_begin, zr_dcm);
+        df_begin = crv.get_df(yr_frac_begin);
+    }
+
+    // calculate year fraction for interest period
+    this->yr_frac_int = fin_date::day_count_method(date_begin, date_end, generator->instr_def.fra.dcm);
+
+    // calculate forward discount factor
+    this->df = df_begin / (1.0 + this->par_rate * this->yr_frac_int);
+
+    // calculate year fraction for payment period following day count method of the underlying zero rate curve
+    this->yr_frac_pmt = fin_date::day_count_method(date_exec, date_end, zr_dcm);
+
+    // calibration equation
+    this->eq.dfs.push_back({1.0 + this->par_rate * this->yr_frac_int, this->yr_frac_pmt});
+    this->eq.dfs.push_back({-1.0, yr_frac_begin});
+    this->eq.dfs_derivs = {this->yr_frac_int, 0.0};
+
+    // convert discount factor into zero rate following convention of the underlying zero rate curve
+    this->zr = fin_curves::df_to_zr(this->df, this->yr_frac_pmt, crv.get_def().zr_type);
+}
+
+std::vector<std::tuple<double, double>> fin_curves::myFraInstr::eval(const std::string& date, const std::vector<std::string>& tenors, const std::vector<double>& par_rates, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, std::string date_format)
+{
+    // check that the vectors are of the same length
+    if (tenors.size() != par_rates.size())
+        throw std::runtime_error((std::string)__func__ + ": Vector of tenors and vector of par rates are of different length!");
+
+    // working copy of the curve so that FRAs within the strip could build on each other
+    fin_curves::myZeroRate crv_aux = crv;
+
+    // evaluate FRA by FRA
+    std::vector<std::tuple<double, double>> yr_fracs_zrs;
+    for (std::size_t idx = 0; idx < tenors.size(); idx++)
+    {
+        fin_curves::myFraInstr fra = fin_curves::myFraInstr(date, tenors[idx], par_rates[idx], generator, crv_aux, date_format);
+        yr_fracs_zrs.push_back(fra.get_yr_frac_zr());
+        crv_aux.add(fra.get_yr_frac_zr());
+    }
+
+    // return maturity year fractions and zero rates
+    return yr_fracs_zrs;
+}
@@ -0,0 +1,86 @@
+/** \example fin_frainstr_examples.h
+ * @file fin_frainstr.h
+ * @author Michal Mackanic
+ * @brief Implement FRA instrument.
+ * @version 1.0
+ * @date 2024-02-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+# pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <memory>
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_generators.h"
+#include "fin_calibration.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Object evaluating FRA instrument upon its creation. Unlike myDepoInstr, the underlying zero rate curve is not modified; the result has to be added to the curve by the caller.
+     * 
+     */
+    class myFraInstr
+    {
+        private:
+            double yr_frac_int;
+            double yr_frac_pmt;
+            double par_rate;
+            double df;
+            double zr;
+            fin_curves::calib_eq eq;
+
+        public:
+            /**
+             * @brief Construct a new myFraInstr object and evaluate FRA instrument, i.e. calculate its maturity year fraction, discount factor and zero rate.
+             * 
+             * @param date Date from which FRA maturity is derived using tenor information.
+             * @param tenor Frequency string defining FRA maturity, e.g. "4M"; the FRA starts one generator period, e.g. "3M", before its maturity.
+             * @param par_rate FRA rate quoted on market for the respective maturity tenor as of execution date.
+             * @param generator Generator with definitions needed to evaluate FRA instrument.
+             * @param crv Zero rate curve providing discount factor as of FRA start date.
+             * @param date_format Date format.
+             */
+            myFraInstr(const std::string& date, const std::string& tenor, const double& par_rate, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, std::string date_format = "yyyymmdd");
+
+            /**
+             * @brief Get FRA maturity year fraction and zero rate following convention of the underlying zero rate curve.
+             * 
+             * @return std::tuple<double, double> Maturity year fraction and zero rate.
+             */
+            std::tuple<double, double> get_yr_frac_zr() const {return {this->yr_frac_pmt, this->zr};};
+
+            /**
+             * @brief Get discount factor as of FRA maturity.
+             * 
+             * @return double Discount factor.
+             */
+            double get_df() const {return this->df;};
+
+            /**
+             * @brief Get calibration equation of the FRA, i.e. DF(maturity) * (1 + par rate * accrual year fraction) - DF(start) = 0.
+             * 
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq() const {return this->eq;};
+
+            /**
+             * @brief Evaluate strip of FRA instruments sharing the same generator. FRAs are evaluated in the order of their tenors and each FRA might use discount factors of the preceding FRAs within the strip.
+             * 
+             * @param date Date from which FRA maturities are derived using tenor information.
+             * @param tenors Vector of frequency strings defining FRA maturities sorted in ascending order.
+             * @param par_rates Vector of FRA rates.
+             * @param generator Generator with definitions needed to evaluate FRA instruments.
+             * @param crv Zero rate curve providing discount factors for FRA start dates; the curve is not modified.
+             * @param date_format Date format.
+             * @return std::vector<std::tuple<double, double>> Vector of maturity year fractions and zero rates.
+             */
+            static std::vector<std::tuple<double, double>> eval(const std::string& date, const std::vector<std::string>& tenors, const std::vector<double>& par_rates, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, std::string date_format = "yyyymmdd");
+    };
+}
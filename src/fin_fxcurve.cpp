@@ -0,0 +1,194 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+#include "lib_date.h"
+#include "lib_tbl.h"
+#include "fin_fxcurve.h"
+
+// generate myFxCurve object using definitions stored in fin_curves::fx_interp_def
+fin_curves::myFxCurve::myFxCurve(const std::string& crv_nm, const fin_curves::fx_interp_def& interp_def, const std::string& path)
+{
+    // store variables into the object
+    this->path = path;
+    this->crv_nm = crv_nm;
+    this->interp_def = interp_def;
+}
+
+// generate myFxCurve object using definition stored in a .csv file
+fin_curves::myFxCurve::myFxCurve(const std::string& path, const std::string& crv_nm, const std::string& sep, const bool& quotes)
+{
+    // store variables into the object
+    this->path = path;
+    this->crv_nm = crv_nm;
+
+    // read file with curve definition
+    lib_tbl::myTable crv_def;
+    crv_def.read(this->path + "inputs/curves/" + this->crv_nm + ".csv", sep, quotes);
+
+    // extract curve definition
+    fin_curves::fx_interp_def interp_def;
+    interp_def.ccy1 = *crv_def.get_str_column("ccy1")[0];
+    interp_def.ccy2 = *crv_def.get_str_column("ccy2")[0];
+    interp_def.dcm = *crv_def.get_str_column("dcm")[0];
+    interp_def.interp = *crv_def.get_str_column("interp")[0];
+    this->interp_def = interp_def;
+
+    // check interpolation method
+    if (this->interp_def.interp.compare("linear") != 0)
+        throw std::runtime_error((std::string)__func__ + ": '" + this->interp_def.interp + "' is not a supported interpolation!");
+}
+
+// set date of FX forwards
+void fin_curves::myFxCurve::set_date(const std::string& date, const std::string& date_format)
+{
+    // convert date to yyyymmdd if necessary
+    std::string date_str = date;
+    if (date_format.compare("yyyymmdd") != 0)
+    {
+        lib_date::myDate date_aux(date, date_format);
+        date_str = date_aux.get_date_str();
+    }
+
+    // store date into FX curve object
+    this->date = date_str;
+}
+
+// set FX spot rate; all FX forwards are removed
+void fin_curves::myFxCurve::set_spot(const double& spot)
+{
+    this->yr_fracs.clear();
+    this->fxs.clear();
+    this->add({0.0, spot});
+}
+
+// load myFxCurve object with maturity year fractions and corresponding FX forwards stored in vectors
+void fin_curves::myFxCurve::load(const std::string& date, const std::vector<double>& yr_fracs, const std::vector<double>& fxs, const std::string& date_format)
+{
+    // store date into FX curve object
+    this->set_date(date, date_format);
+
+    // check that vector of year fractions has the same length as vector of FX forwards
+    if (yr_fracs.size() != fxs.size())
+        throw std::runtime_error((std::string)__func__ + ": Vector of year fractions and vector of FX forwards are of different length!");
+
+    // the first node must hold FX spot rate
+    if ((yr_fracs.size() == 0) || (yr_fracs[0] != 0.0))
+        throw std::runtime_error((std::string)__func__ + ": The first node of FX curve '" + this->crv_nm + "' must hold FX spot rate!");
+
+    // copy year fractions and corresponding FX forwards
+    this->yr_fracs = yr_fracs;
+    this->fxs = fxs;
+}
+
+// load maturity year fractions and FX forwards from a .csv file
+void fin_curves::myFxCurve::load(const std::string& date, const std::string& date_format, const std::string& sep, const bool& quotes)
+{
+    // store date into FX curve object
+    this->set_date(date, date_format);
+
+    // read FX forwards
+    lib_tbl::myTable fx_data;
+    fx_data.read(this->path + "outputs/curves/" + this->crv_nm + "_" + this->date + ".csv", sep, quotes);
+
+    std::vector<double> yr_fracs;
+    for (std::shared_ptr<double> yr_frac : fx_data.get_double_column("yr_fracs"))
+        yr_fracs.push_back(*yr_frac);
+
+    std::vector<double> fxs;
+    for (std::shared_ptr<double> fx : fx_data.get_double_column("fxs"))
+        fxs.push_back(*fx);
+
+    // copy year fractions and corresponding FX forwards
+    this->load(this->date, yr_fracs, fxs);
+}
+
+// get FX spot rate
+double fin_curves::myFxCurve::get_spot() const
+{
+    if (this->yr_fracs.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": FX spot rate of curve '" + this->crv_nm + "' is not set!");
+
+    return this->fxs[0];
+}
+
+// get FX forward for a provided maturity year fraction
+double fin_curves::myFxCurve::get_fx(const double& yr_frac) const
+{
+    // FX forwards outside of curve nodes are flat
+    std::size_t nodes_no = this->yr_fracs.size();
+    if (nodes_no == 0)
+        throw std::runtime_error((std::string)__func__ + ": FX curve '" + this->crv_nm + "' is empty!");
+    if (yr_frac <= this->yr_fracs[0])
+        return this->fxs[0];
+    if (yr_frac >= this->yr_fracs[nodes_no - 1])
+        return this->fxs[nodes_no - 1];
+
+    // find the first node following the year fraction and interpolate linearly
+    std::size_t idx = std::upper_bound(this->yr_fracs.begin(), this->yr_fracs.end(), yr_frac) - this->yr_fracs.begin();
+    double weight = (yr_frac - this->yr_fracs[idx - 1]) / (this->yr_fracs[idx] - this->yr_fracs[idx - 1]);
+    return this->fxs[idx - 1] + (this->fxs[idx] - this->fxs[idx - 1]) * weight;
+}
+
+// save FX curve definition into a .csv file
+void fin_curves::myFxCurve::save_def(const std::string& sep)
+{
+    // open .csv file
+    std::string file_nm = this->path + "inputs/curves/" + this->crv_nm + ".csv";
+    std::ofstream myfile(file_nm);
+    if (myfile.is_open())
+    {
+        // write headers
+        std::vector<std::string> headers = {"ccy1", "ccy2", "dcm", "interp"};
+        for (std::size_t idx = 0; idx < headers.size(); idx++)
+        {
+            myfile << headers[idx];
+            if (idx < headers.size() - 1)
+                myfile << sep;
+        }
+        myfile << '\n';
+
+        // add curve definition
+        myfile << this->interp_def.ccy1 << sep;
+        myfile << this->interp_def.ccy2 << sep;
+        myfile << this->interp_def.dcm << sep;
+        myfile << this->interp_def.interp;
+        myfile << '\n';
+
+        // close file
+        myfile.close();
+    }
+    else
+        throw std::runtime_error((std::string)__func__ + ": cannot open file '" + file_nm + "'!");
+}
+
+// save FX forwards into a .csv file
+void fin_curves::myFxCurve::save_data(const std::string& sep, const std::string& suffix)
+{
+    // open .csv file
+    std::string file_nm = this->path + "outputs/curves/" + this->crv_nm + "_" + this->date + suffix + ".csv";
+    std::ofstream myfile(file_nm);
+    if (myfile.is_open())
+    {
+        // write headers
+        std::vector<std::string> headers = {"yr_fracs", "fxs"};
+        for (std::size_t idx = 0; idx < headers.size(); idx++)
+        {
+            myfile << headers[idx];
+            if (idx < headers.size() - 1)
+                myfile << sep;
+        }
+        myfile << '\n';
+
+        // add data; use full precision so that the curve could be reloaded without loss
+        myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (std::size_t idx = 0; idx < this->yr_fracs.size(); idx++)
+            myfile << this->yr_fracs[idx] << sep << this->fxs[idx] << '\n';
+
+        // close file
+        myfile.close();
+    }
+    else
+        throw std::runtime_error((std::string)__func__ + ": cannot open file '" + file_nm + "'!");
+}
@@ -0,0 +1,190 @@
+/** \example fin_fxcurve_examples.h
+ * @file fin_fxcurve.h
+ * @author Michal Mackanic
+ * @brief FX curve object returns FX forward rates.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+
+namespace fin_curves
+{
+    /**
+     * @brief Structure describing FX curve, i.e. currency pair ccy1/ccy2 quoted as number of ccy2 units per one unit of ccy1, and its interpolation.
+     *
+     */
+    struct fx_interp_def
+    {
+        std::string ccy1;
+        std::string ccy2;
+        std::string dcm;
+        std::string interp;
+    };
+
+    /**
+     * @brief FX curve object. The first node, i.e. year fraction 0.0, holds FX spot rate.
+     *
+     */
+    class myFxCurve
+    {
+        private:
+            std::string path = "--na--";
+            std::string crv_nm = "--na--";
+            std::string date;
+            std::vector<double> yr_fracs;
+            std::vector<double> fxs;
+            fin_curves::fx_interp_def interp_def;
+
+        public:
+            /**
+             * @brief Construct a new myFxCurve object from definition of curve interpolation.
+             *
+             * @param crv_nm Curve name, e.g. "eur_usd".
+             * @param interp_def Structure describing FX curve.
+             * @param path Path where curve definition and FX forwards should be stored.
+             */
+            myFxCurve(const std::string& crv_nm, const fin_curves::fx_interp_def& interp_def, const std::string& path = "--na--");
+
+            /**
+             * @brief Construct a new myFxCurve object using curve definition stored in a .csv file.
+             *
+             * @param path Path to data folder; curve definition is expected in its "inputs/curves/" subfolder.
+             * @param crv_nm Curve name that corresponds to .csv file name with curve definition.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            myFxCurve(const std::string& path, const std::string& crv_nm, const std::string& sep = ",", const bool& quotes = false);
+
+            /**
+             * @brief Set date of FX forwards.
+             *
+             * @param date Date.
+             * @param date_format Date format.
+             */
+            void set_date(const std::string& date, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Set FX spot rate; all FX forwards are removed.
+             *
+             * @param spot FX spot rate.
+             */
+            void set_spot(const double& spot);
+
+            /**
+             * @brief Load myFxCurve object with maturity year fractions and corresponding FX forwards stored in vectors.
+             *
+             * @param date Date of FX forwards.
+             * @param yr_fracs Vector of maturity year fractions sorted in ascending order starting with 0.0, i.e. FX spot rate.
+             * @param fxs Vector of FX forwards.
+             * @param date_format Date format.
+             */
+            void load(const std::string& date, const std::vector<double>& yr_fracs, const std::vector<double>& fxs, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Load myFxCurve object with maturity year fractions and FX forwards stored in "outputs/curves/" subfolder of the data folder.
+             *
+             * @param date Date of FX forwards.
+             * @param date_format Date format.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            void load(const std::string& date, const std::string& date_format = "yyyymmdd", const std::string& sep = ",", const bool& quotes = false);
+
+            /**
+             * @brief Get curve name.
+             *
+             * @return std::string Curve name.
+             */
+            std::string get_crv_nm() const {return this->crv_nm;};
+
+            /**
+             * @brief Get date of FX forwards.
+             *
+             * @return std::string Date.
+             */
+            std::string get_date() const {return this->date;};
+
+            /**
+             * @brief Get FX spot rate.
+             *
+             * @return double FX spot rate.
+             */
+            double get_spot() const;
+
+            /**
+             * @brief Get FX forward using year fraction. Nodes are located through binary search and FX forwards are linearly interpolated; FX forwards beyond
+             * the last node are flat.
+             *
+             * @param yr_frac Year fraction.
+             * @return double FX forward.
+             */
+            double get_fx(const double& yr_frac) const;
+
+            /**
+             * @brief Get FX forward using index.
+             *
+             * @param idx FX forward position index starting with 0.
+             * @return double FX forward.
+             */
+            double get_fx(const std::size_t& idx) const {return this->fxs[idx];};
+
+            /**
+             * @brief Get full vector of year_fractions.
+             *
+             * @return std::vector<double> Vector of year fractions.
+             */
+            std::vector<double> get_yr_fracs() const {return this->yr_fracs;};
+
+            /**
+             * @brief Get the maturity year fraction using index.
+             *
+             * @param idx Year fraction position index starting with 0.
+             * @return double Year fraction.
+             */
+            double get_yr_frac(const std::size_t& idx) const {return this->yr_fracs[idx];};
+
+            /**
+             * @brief Get number of curve nodes including FX spot rate.
+             *
+             * @return std::size_t Number of curve nodes.
+             */
+            std::size_t get_size() const {return this->yr_fracs.size();};
+
+            /**
+             * @brief Add tuple containing year fraction and FX forward to the object.
+             *
+             * @param yr_frac_fx Tuple containing year fraction and FX forward.
+             */
+            void add(const std::tuple<double, double>& yr_frac_fx) {this->yr_fracs.push_back(std::get<0>(yr_frac_fx)); this->fxs.push_back(std::get<1>(yr_frac_fx));};
+
+            /**
+             * @brief Get the FX curve definition.
+             *
+             * @return fin_curves::fx_interp_def FX curve definition.
+             */
+            fin_curves::fx_interp_def get_def() const {return this->interp_def;};
+
+            /**
+             * @brief Save FX curve definition into a .csv file.
+             *
+             * @param sep Separator to be used in the .csv file.
+             */
+            void save_def(const std::string& sep = ",");
+
+            /**
+             * @brief Save FX forwards into a .csv file named after curve and date followed by a suffix.
+             *
+             * @param sep Separator to be used in the .csv file.
+             * @param suffix Suffix of the file name; "" => no suffix.
+             */
+            void save_data(const std::string& sep = ",", const std::string& suffix = "");
+    };
+}
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include "fin_date.h"
+#include "fin_curves.h"
+#include "fin_fxswpinstr.h"
+
+fin_curves::myFxSwpInstr::myFxSwpInstr(const std::string& date, const std::string& tenor, const double& fwd_pts, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myFxCurve& fx_crv, const fin_curves::myZeroRate& oth_crv, const fin_curves::myZeroRate& crv, std::string date_format)
+{
+    // check that the generator is FX swap
+    if (generator->instr_tp.compare("fxswp") != 0)
+        throw std::runtime_error((std::string)__func__ + ": Instrument '" + generator->instr_nm + "' is not an FX swap!");
+
+    // check that the curves match the currency pair
+    fin_curves::fx_interp_def fx_def = fx_crv.get_def();
+    std::string ccy = crv.get_def().ccy;
+    std::string oth_ccy = oth_crv.get_def().ccy;
+    bool is_ccy1 = (ccy.compare(fx_def.ccy1) == 0) && (oth_ccy.compare(fx_def.ccy2) == 0);
+    bool is_ccy2 = (ccy.compare(fx_def.ccy2) == 0) && (oth_ccy.compare(fx_def.ccy1) == 0);
+    if (!is_ccy1 && !is_ccy2)
+        throw std::runtime_error((std::string)__func__ + ": Currencies '" + ccy + "' and '" + oth_ccy + "' do not match FX curve '" + fx_crv.get_crv_nm() + "'!");
+
+    // store forward points
+    this->fwd_pts = fwd_pts;
+
+    // get payment calendar
+    lib_date::myDate date_exec = lib_date::myDate(date, date_format);
+    std::size_t year_start = date_exec.get_year();
+    const std::vector<lib_date::myDate>& holidays = fin_date::get_holidays(generator->instr_def.fxswp.cal_pmt, year_start, year_start + 100);
+
+    // determine start and maturity date; FX spot date is two working days after execution date and forward points of ON and TN swaps refer to the
+    // periods preceding the spot date
+    lib_date::myDate date_begin = date_exec;
+    lib_date::myDate date_end = date_exec;
+    if (tenor.compare("ON") == 0)
+        date_end.add_working_days(holidays, 1);
+    else if (tenor.compare("TN") == 0)
+    {
+        date_begin.add_working_days(holidays, 1);
+        date_end.add_working_days(holidays, 2);
+    }
+    else
+    {
+        date_begin.add_working_days(holidays, 2);
+        date_end.add_working_days(holidays, 2);
+        date_end.add(fin_date::compose_freq(fin_date::decompose_freq(tenor)));
+        fin_date::date_rolling(date_end, holidays, generator->instr_def.fxswp.drm);
+    }
+
+    // FX forward
+    double spot = fx_crv.get_spot();
+    this->fx = spot + this->fwd_pts;
+    this->yr_frac_fx = fin_date::day_count_method(date_exec, date_end, fx_def.dcm);
+
+    // discount factors as of start date; they are given by the preceding ON and TN swaps
+    fin_curves::zr_interp_def zr_def = crv.get_def();
+    std::string oth_dcm = oth_crv.get_def().zr_dcm;
+    double df_begin = 1.0;
+    double oth_df_begin = 1.0;
+    double yr_frac_begin = 0.0;
+    if (date_begin.get_days_no() > date_exec.get_days_no())
+    {
+        if (crv.get_size() == 0)
+            throw std::runtime_error((std::string)__func__ + ": FX swap with tenor '" + tenor + "' requires ON and TN FX swaps to be evaluated first!");
+        yr_frac_begin = fin_date::day_count_method(date_exec, date_begin, zr_def.zr_dcm);
+        df_begin = crv.get_df(yr_frac_begin);
+        oth_df_begin = oth_crv.get_df(fin_date::day_count_method(date_exec, date_begin, oth_dcm));
+    }
+
+    // covered interest parity over the swap period, i.e. fx / spot = (df_ccy1(end) / df_ccy1(begin)) / (df_ccy2(end) / df_ccy2(begin))
+    this->yr_frac_zr = fin_date::day_count_method(date_exec, date_end, zr_def.zr_dcm);
+    double oth_df = oth_crv.get_df(fin_date::day_count_method(date_exec, date_end, oth_dcm));
+    double df_ratio = is_ccy2 ? oth_df / oth_df_begin * spot / this->fx : oth_df / oth_df_begin * this->fx / spot;
+    this->df = df_begin * df_ratio;
+
+    // calibration equation
+    this->eq.dfs.push_back({1.0, this->yr_frac_zr});
+    this->eq.dfs.push_back({-df_ratio, yr_frac_begin});
+    this->eq.dfs_derivs = {0.0, is_ccy2 ? df_ratio / this->fx : -df_ratio / this->fx};
+
+    // convert discount factor into zero rate following convention of the derived zero rate curve
+    this->zr = fin_curves::df_to_zr(this->df, this->yr_frac_zr, zr_def.zr_type);
+}
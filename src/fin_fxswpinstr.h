@@ -0,0 +1,87 @@
+/** \example fin_fxswpinstr_examples.h
+ * @file fin_fxswpinstr.h
+ * @author Michal Mackanic
+ * @brief Implement FX swap instrument.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+# pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <memory>
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_fxcurve.h"
+#include "fin_generators.h"
+#include "fin_calibration.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Object evaluating FX swap instrument upon its creation, i.e. FX forward given by FX spot rate and forward points and discount factor of one
+     * currency of the pair implied by zero rate curve of the other currency through covered interest parity. Neither FX curve nor zero rate curves are
+     * modified; the results have to be added to the curves by the caller.
+     *
+     */
+    class myFxSwpInstr
+    {
+        private:
+            double yr_frac_fx;
+            double yr_frac_zr;
+            double fwd_pts;
+            double fx;
+            double df;
+            double zr;
+            fin_curves::calib_eq eq;
+
+        public:
+            /**
+             * @brief Construct a new myFxSwpInstr object and evaluate FX swap instrument.
+             *
+             * @param date Date from which FX swap maturity is derived using tenor information.
+             * @param tenor Frequency string defining FX swap maturity, e.g. "ON", "TN", "1W", "18M"; tenors other than "ON" and "TN" start at FX spot date and
+             * require ON and TN swaps to be already added to the derived zero rate curve.
+             * @param fwd_pts Forward points, i.e. difference between FX forward and FX spot rate.
+             * @param generator Generator with definitions needed to evaluate FX swap instrument.
+             * @param fx_crv FX curve providing FX spot rate and currency pair.
+             * @param oth_crv Zero rate curve of the other currency of the pair.
+             * @param crv Zero rate curve to be derived; it provides discount factor as of swap start date and defines day count method and zero rate type of the result.
+             * @param date_format Date format.
+             */
+            myFxSwpInstr(const std::string& date, const std::string& tenor, const double& fwd_pts, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myFxCurve& fx_crv, const fin_curves::myZeroRate& oth_crv, const fin_curves::myZeroRate& crv, std::string date_format = "yyyymmdd");
+
+            /**
+             * @brief Get FX swap maturity year fraction following day count method of the FX curve and FX forward.
+             *
+             * @return std::tuple<double, double> Maturity year fraction and FX forward.
+             */
+            std::tuple<double, double> get_yr_frac_fx() const {return {this->yr_frac_fx, this->fx};};
+
+            /**
+             * @brief Get FX swap maturity year fraction and zero rate following convention of the derived zero rate curve.
+             *
+             * @return std::tuple<double, double> Maturity year fraction and zero rate.
+             */
+            std::tuple<double, double> get_yr_frac_zr() const {return {this->yr_frac_zr, this->zr};};
+
+            /**
+             * @brief Get discount factor as of FX swap maturity.
+             *
+             * @return double Discount factor.
+             */
+            double get_df() const {return this->df;};
+
+            /**
+             * @brief Get calibration equation of the FX swap, i.e. DF(maturity) - DF(start) * implied discount factor ratio = 0.
+             *
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq() const {return this->eq;};
+    };
+}
@@ -4,7 +4,7 @@
 #include "lib_tbl.h"
 #include "fin_generators.h"
 
-fin_curves::myGenerators::myGenerators(const std::vector<std::string>& instrument_nms, const std::string& sep, const bool& quotes)
+fin_curves::myGenerators::myGenerators(const std::vector<std::string>& instrument_nms, const std::string& path, const std::string& sep, const bool& quotes)
 {
     // clear old information
     this->instruments.clear();
@@ -16,7 +16,7 @@ fin_curves::myGenerators::myGenerators(const std::vector<std::string>& instrumen
     for (std::string instrument_nm : instrument_nms)
     {
         // load file with instrument definition
-        std::string file_nm = "/home/macky/Documents/Programming/C++/FinCurves/data/inputs/generators/" + instrument_nm + ".csv";
+        std::string file_nm = path + "inputs/generators/" + instrument_nm + ".csv";
         instrument_def.read(file_nm, sep, quotes);
 
         // select specific generator
@@ -109,10 +109,31 @@ fin_curves::myGenerators::myGenerators(const std::vector<std::string>& instrumen
             generator->instr_def.bsswp = bsswp;
             this->instruments.insert(std::pair<std::string, std::shared_ptr<fin_curves::generator>>(instrument_nm, generator));
         }
+        else if (instrument_tp.compare("fxswp") == 0)
+        {
+            fin_curves::fxswp fxswp;
+            fxswp.cal_pmt = *instrument_def.get_str_column("cal_pmt")[0];
+            fxswp.drm = *instrument_def.get_str_column("drm")[0];
+            fxswp.dcm = *instrument_def.get_str_column("dcm")[0];
+
+            std::shared_ptr<fin_curves::generator> generator = std::make_shared<fin_curves::generator>();
+            generator->instr_nm = instrument_nm;
+            generator->instr_tp = instrument_tp;
+            generator->instr_def.fxswp = fxswp;
+            this->instruments.insert(std::pair<std::string, std::shared_ptr<fin_curves::generator>>(instrument_nm, generator));
+        }
+        else
+            throw std::runtime_error((std::string)__func__ + ": Instrument type '" + instrument_tp + "' of generator '" + instrument_nm + "' is not supported!");
     }
 }
 
 std::shared_ptr<fin_curves::generator> fin_curves::myGenerators::get(const std::string& instrument_nm) const
 {
-    return this->instruments.find(instrument_nm)->second;
+    // check that the generator was loaded
+    auto generator = this->instruments.find(instrument_nm);
+    if (generator == this->instruments.end())
+        throw std::runtime_error((std::string)__func__ + ": Generator '" + instrument_nm + "' is not loaded!");
+
+    // return generator
+    return generator->second;
 }
\ No newline at end of file
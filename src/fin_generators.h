@@ -96,6 +96,17 @@ namespace fin_curves
         int for_leg_days_shift;
     };
 
+    /**
+     * @brief FX swap.
+     * 
+     */
+    struct fxswp
+    {
+        std::string cal_pmt;
+        std::string drm;
+        std::string dcm;
+    };
+
     /**
      * @brief General financial instrument.
      * 
@@ -107,6 +118,7 @@ namespace fin_curves
         fin_curves::ois ois;
         fin_curves::irswp irswp;
         fin_curves::bsswp bsswp;
+        fin_curves::fxswp fxswp;
         instrument(){};
         ~instrument(){};
     };
@@ -142,10 +154,11 @@ namespace fin_curves
              * @brief Construct a new myGenerators object using their definition stored in .csv files. Generators hold definitions needed for intrument evaluation, e.g. currency, day-count method, day-rolling method, fixing frequency, calendar, etc.
              * 
              * @param instrument_nms Vector of instrument names.
+             * @param path Path to data folder; generator definitions are expected in its "inputs/generators/" subfolder.
              * @param sep Column separator.
              * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
              */
-            myGenerators(const std::vector<std::string>& instrument_nms, const std::string& sep = ",", const bool& quotes = false);
+            myGenerators(const std::vector<std::string>& instrument_nms, const std::string& path = "/home/macky/Documents/Programming/C++/FinCurves/data/", const std::string& sep = ",", const bool& quotes = false);
 
             /**
              * @brief Return generator for a specified instrument.
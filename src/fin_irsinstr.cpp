@@ -0,0 +1,300 @@
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "fin_date.h"
+#include "fin_curves.h"
+#include "fin_zerorate.h"
+#include "fin_irsinstr.h"
+
+fin_curves::myIrsInstr::myIrsInstr(const std::string& date, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, const std::shared_ptr<fin_curves::myZeroRate>& dsc_crv, std::string date_format)
+{
+    // check that the generator is interest rate swap
+    if (generator->instr_tp.compare("irswp") != 0)
+        throw std::runtime_error((std::string)__func__ + ": Instrument '" + generator->instr_nm + "' is not an interest rate swap!");
+
+    // store variables into the object
+    this->date_exec = lib_date::myDate(date, date_format);
+    this->generator = generator;
+    this->dsc_crv = dsc_crv;
+    this->zr_dcm = crv.get_def().zr_dcm;
+    this->zr_type = crv.get_def().zr_type;
+    this->yr_frac_last = 0.0;
+    this->iters_no = 0;
+
+    // get calendars
+    const fin_curves::irswp& irswp = generator->instr_def.irswp;
+    std::size_t year_start = this->date_exec.get_year();
+    this->holidays_fix_pmt = &fin_date::get_holidays(irswp.fix_leg_cal_pmt, year_start, year_start + 100);
+    this->holidays_flt_pmt = &fin_date::get_holidays(irswp.flt_leg_cal_pmt, year_start, year_start + 100);
+    const std::vector<lib_date::myDate>& holidays_flt_fix = fin_date::get_holidays(irswp.flt_leg_cal_fix, year_start, year_start + 100);
+
+    // determine spot dates of both legs
+    this->fix_leg.date_spot = this->date_exec;
+    if (irswp.fix_leg_days_shift > 0)
+        this->fix_leg.date_spot.add_working_days(*this->holidays_fix_pmt, irswp.fix_leg_days_shift);
+
+    this->flt_leg.date_spot = this->date_exec;
+    if (irswp.flt_leg_days_shift > 0)
+        this->flt_leg.date_spot.add_working_days(holidays_flt_fix, irswp.flt_leg_days_shift);
+
+    // initialize legs
+    for (fin_curves::irs_leg* leg : {&this->fix_leg, &this->flt_leg})
+    {
+        leg->yr_frac_spot = fin_date::day_count_method(this->date_exec, leg->date_spot, this->zr_dcm);
+        leg->cpns_done_no = 0;
+        leg->pv_done = 0.0;
+    }
+    this->fix_leg.freq = fin_date::decompose_freq(irswp.fix_leg_freq);
+    this->flt_leg.freq = fin_date::decompose_freq(irswp.flt_leg_freq);
+}
+
+// generate regular coupon dates of a leg up to a specified number of coupons
+void fin_curves::myIrsInstr::extend_leg(fin_curves::irs_leg& leg, const std::size_t& cpns_no, const std::string& cal, const std::string& dcm)
+{
+    if (leg.dates.size() >= cpns_no)
+        return;
+
+    // coupon dates are shared with bootstraps of the same date processed by the thread before
+    std::size_t year_start = this->date_exec.get_year();
+    std::vector<lib_date::myDate> dates_cpn = fin_date::get_cpn_dates(leg.date_spot, leg.freq, cpns_no, cal, year_start, year_start + 100, this->generator->instr_def.irswp.drm);
+    for (std::size_t cpn_no = leg.dates.size() + 1; cpn_no <= cpns_no; cpn_no++)
+    {
+        const lib_date::myDate& date_cpn = dates_cpn[cpn_no - 1];
+        const lib_date::myDate& date_prev = (cpn_no == 1) ? leg.date_spot : leg.dates.back();
+        leg.yr_fracs_acr.push_back(fin_date::day_count_method(date_prev, date_cpn, dcm));
+        leg.yr_fracs.push_back(fin_date::day_count_method(this->date_exec, date_cpn, this->zr_dcm));
+        leg.dates.push_back(date_cpn);
+        if (this->dsc_crv != nullptr)
+            leg.dfs_dsc.push_back(this->dsc_crv->get_df(leg.yr_fracs.back()));
+    }
+}
+
+// generate schedule of a swap of the strip
+fin_curves::irs_swp fin_curves::myIrsInstr::get_swp(const std::string& tenor)
+{
+    const fin_curves::irswp& irswp = this->generator->instr_def.irswp;
+    fin_curves::irs_swp swp;
+
+    // express tenor and coupon frequencies in months; errors are reported under name of this function
+    const std::string func_nm = __func__;
+    auto get_months = [&](const std::tuple<int, std::string>& freq) -> int
+    {
+        if (std::get<1>(freq).compare("Y") == 0)
+            return 12 * std::get<0>(freq);
+        else if (std::get<1>(freq).compare("M") == 0)
+            return std::get<0>(freq);
+        else
+            throw std::runtime_error(func_nm + ": Swap '" + this->generator->instr_nm + "' supports only monthly and yearly tenors and frequencies!");
+    };
+    std::tuple<int, std::string> freq_end = fin_date::decompose_freq(tenor);
+    int months_end = get_months(freq_end);
+    swp.fix_cpns_no = (months_end - 1) / get_months(this->fix_leg.freq);
+    swp.flt_cpns_no = (months_end - 1) / get_months(this->flt_leg.freq);
+
+    // regular coupons are shared with the preceding swaps of the strip; only the missing ones are generated
+    this->extend_leg(this->fix_leg, swp.fix_cpns_no, irswp.fix_leg_cal_pmt, irswp.fix_leg_dcm);
+    this->extend_leg(this->flt_leg, swp.flt_cpns_no, irswp.flt_leg_cal_pmt, irswp.flt_leg_dcm);
+
+    // the last coupon ends at swap maturity
+    lib_date::myDate fix_date_end = this->fix_leg.date_spot;
+    fix_date_end.add(fin_date::compose_freq(freq_end));
+    fin_date::date_rolling(fix_date_end, *this->holidays_fix_pmt, irswp.drm);
+    const lib_date::myDate& fix_date_prev = (swp.fix_cpns_no == 0) ? this->fix_leg.date_spot : this->fix_leg.dates[swp.fix_cpns_no - 1];
+    swp.fix_yr_frac_end = fin_date::day_count_method(this->date_exec, fix_date_end, this->zr_dcm);
+    swp.fix_yr_frac_acr_end = fin_date::day_count_method(fix_date_prev, fix_date_end, irswp.fix_leg_dcm);
+
+    lib_date::myDate flt_date_end = this->flt_leg.date_spot;
+    flt_date_end.add(fin_date::compose_freq(freq_end));
+    fin_date::date_rolling(flt_date_end, *this->holidays_flt_pmt, irswp.drm);
+    swp.flt_yr_frac_end = fin_date::day_count_method(this->date_exec, flt_date_end, this->zr_dcm);
+    swp.flt_yr_frac_begin_end = (swp.flt_cpns_no == 0) ? this->flt_leg.yr_frac_spot : this->flt_leg.yr_fracs[swp.flt_cpns_no - 1];
+
+    // discount factors of the last coupons if swap is discounted by a known curve
+    swp.fix_df_dsc_end = (this->dsc_crv == nullptr) ? 0.0 : this->dsc_crv->get_df(swp.fix_yr_frac_end);
+    swp.flt_df_dsc_end = (this->dsc_crv == nullptr) ? 0.0 : this->dsc_crv->get_df(swp.flt_yr_frac_end);
+
+    // swap maturity node
+    swp.yr_frac_node = std::max(swp.fix_yr_frac_end, swp.flt_yr_frac_end);
+
+    return swp;
+}
+
+// build calibration equation of a swap of the strip
+fin_curves::calib_eq fin_curves::myIrsInstr::build_calib_eq(const fin_curves::irs_swp& swp, const double& par_rate) const
+{
+    // floating coupon discounted by the curve being bootstrapped telescopes to DF(start) - DF(end); discount factors of the discount curve are listed
+    // alongside, so that sensitivities of the residual to the discount curve could be evaluated
+    fin_curves::calib_eq eq;
+    auto add_fix_cpn = [&](const double& yr_frac_acr, const double& yr_frac, const double& df_dsc)
+    {
+        if (this->dsc_crv == nullptr)
+        {
+            eq.dfs.push_back({par_rate * yr_frac_acr, yr_frac});
+            eq.dfs_derivs.push_back(yr_frac_acr);
+        }
+        else
+        {
+            eq.cst += par_rate * yr_frac_acr * df_dsc;
+            eq.cst_deriv += yr_frac_acr * df_dsc;
+            eq.dsc_dfs.push_back({par_rate * yr_frac_acr, yr_frac});
+        }
+    };
+    auto add_flt_cpn = [&](const double& yr_frac_begin, const double& yr_frac_end, const double& df_dsc)
+    {
+        if (this->dsc_crv == nullptr)
+        {
+            eq.dfs.push_back({-1.0, yr_frac_begin});
+            eq.dfs.push_back({1.0, yr_frac_end});
+            eq.dfs_derivs.insert(eq.dfs_derivs.end(), {0.0, 0.0});
+        }
+        else
+        {
+            eq.df_ratios.push_back({-df_dsc, yr_frac_begin, yr_frac_end});
+            eq.df_ratios_dsc.push_back({-1.0, yr_frac_end});
+            eq.cst += df_dsc;
+            eq.dsc_dfs.push_back({1.0, yr_frac_end});
+        }
+    };
+    for (std::size_t idx = 0; idx < swp.fix_cpns_no; idx++)
+        add_fix_cpn(this->fix_leg.yr_fracs_acr[idx], this->fix_leg.yr_fracs[idx], (this->dsc_crv == nullptr) ? 0.0 : this->fix_leg.dfs_dsc[idx]);
+    add_fix_cpn(swp.fix_yr_frac_acr_end, swp.fix_yr_frac_end, swp.fix_df_dsc_end);
+    for (std::size_t idx = 0; idx < swp.flt_cpns_no; idx++)
+    {
+        double yr_frac_begin = (idx == 0) ? this->flt_leg.yr_frac_spot : this->flt_leg.yr_fracs[idx - 1];
+        add_flt_cpn(yr_frac_begin, this->flt_leg.yr_fracs[idx], (this->dsc_crv == nullptr) ? 0.0 : this->flt_leg.dfs_dsc[idx]);
+    }
+    add_flt_cpn(swp.flt_yr_frac_begin_end, swp.flt_yr_frac_end, swp.flt_df_dsc_end);
+
+    return eq;
+}
+
+// get calibration equation of a swap of the strip
+fin_curves::calib_eq fin_curves::myIrsInstr::get_calib_eq(const std::string& tenor, const double& par_rate)
+{
+    return this->build_calib_eq(this->get_swp(tenor), par_rate);
+}
+
+// solve zero rate of the next swap of the strip
+std::tuple<double, double> fin_curves::myIrsInstr::solve(const std::string& tenor, const double& par_rate, const fin_curves::myZeroRate& crv)
+{
+    // swap schedule
+    fin_curves::irs_swp swp = this->get_swp(tenor);
+    std::size_t fix_cpns_no = swp.fix_cpns_no;
+    std::size_t flt_cpns_no = swp.flt_cpns_no;
+    double yr_frac_node = swp.yr_frac_node;
+
+    // last solved node of the curve
+    std::size_t nodes_no = crv.get_size();
+    bool is_empty = (nodes_no == 0);
+    double yr_frac_last = is_empty ? 0.0 : crv.get_yr_frac(nodes_no - 1);
+    double zr_last = is_empty ? par_rate : crv.get_zr(nodes_no - 1);
+    if (yr_frac_last < this->yr_frac_last)
+        throw std::runtime_error((std::string)__func__ + ": Curve nodes of swap strip '" + this->generator->instr_nm + "' were reset; a new strip has to be created!");
+    this->yr_frac_last = yr_frac_last;
+
+    // projection and discount factors of cash flows preceding the last curve node do not change anymore; present values of the respective regular coupons are
+    // added to the cached present values of the legs
+    auto get_prj_df = [&](const double& yr_frac) -> double {return (yr_frac > 0.0) ? crv.get_df(yr_frac) : 1.0;};
+
+    while ((this->fix_leg.cpns_done_no < fix_cpns_no) && ((this->dsc_crv != nullptr) || (!is_empty && (this->fix_leg.yr_fracs[this->fix_leg.cpns_done_no] <= yr_frac_last))))
+    {
+        std::size_t idx = this->fix_leg.cpns_done_no;
+        double df = (this->dsc_crv == nullptr) ? get_prj_df(this->fix_leg.yr_fracs[idx]) : this->fix_leg.dfs_dsc[idx];
+        this->fix_leg.pv_done += this->fix_leg.yr_fracs_acr[idx] * df;
+        this->fix_leg.cpns_done_no++;
+    }
+
+    while ((this->flt_leg.cpns_done_no < flt_cpns_no) && !is_empty && (this->flt_leg.yr_fracs[this->flt_leg.cpns_done_no] <= yr_frac_last))
+    {
+        std::size_t idx = this->flt_leg.cpns_done_no;
+        double yr_frac_begin = (idx == 0) ? this->flt_leg.yr_frac_spot : this->flt_leg.yr_fracs[idx - 1];
+        double yr_frac_end = this->flt_leg.yr_fracs[idx];
+        double df = (this->dsc_crv == nullptr) ? get_prj_df(yr_frac_end) : this->flt_leg.dfs_dsc[idx];
+        this->flt_leg.pv_done += (get_prj_df(yr_frac_begin) / get_prj_df(yr_frac_end) - 1.0) * df;
+        this->flt_leg.cpns_done_no++;
+    }
+
+    // discount factor and its derivative with respect to the zero rate of the swap maturity node; zero rates beyond the last curve node are linearly
+    // interpolated between the last node and the swap maturity node
+    auto get_df_deriv = [&](const double& yr_frac, const double& zr_node) -> std::tuple<double, double>
+    {
+        if (yr_frac <= 0.0)
+            return {1.0, 0.0};
+        if (!is_empty && (yr_frac <= yr_frac_last))
+            return {crv.get_df(yr_frac), 0.0};
+
+        double weight = is_empty ? 1.0 : std::min(1.0, (yr_frac - yr_frac_last) / (yr_frac_node - yr_frac_last));
+        double zr = zr_last + (zr_node - zr_last) * weight;
+        double df = fin_curves::zr_to_df(zr, yr_frac, this->zr_type);
+        double df_deriv = (this->zr_type == 0) ? -yr_frac * df / (1.0 + zr) * weight : -yr_frac * df * weight;
+        return {df, df_deriv};
+    };
+    auto get_dsc_df_deriv = [&](const double& yr_frac, const double& zr_node) -> std::tuple<double, double>
+    {
+        if (this->dsc_crv == nullptr)
+            return get_df_deriv(yr_frac, zr_node);
+        return {this->dsc_crv->get_df(yr_frac), 0.0};
+    };
+
+    // present value of a floating coupon and its derivative; forward rate times accrual year fraction equals ratio of projection discount factors minus one
+    auto get_flt_pv_deriv = [&](const double& yr_frac_begin, const double& yr_frac_end, const double& zr_node) -> std::tuple<double, double>
+    {
+        auto [df_begin, df_begin_deriv] = get_df_deriv(yr_frac_begin, zr_node);
+        auto [df_end, df_end_deriv] = get_df_deriv(yr_frac_end, zr_node);
+        auto [df_dsc, df_dsc_deriv] = get_dsc_df_deriv(yr_frac_end, zr_node);
+        double fwd = df_begin / df_end - 1.0;
+        double fwd_deriv = df_begin_deriv / df_end - df_begin * df_end_deriv / (df_end * df_end);
+        return {fwd * df_dsc, fwd_deriv * df_dsc + fwd * df_dsc_deriv};
+    };
+
+    // solve swap maturity zero rate using Newton-Raphson method; only coupons following the last curve node depend on the solved zero rate
+    double zr_node = zr_last;
+    this->iters_no = 0;
+    while (true)
+    {
+        this->iters_no++;
+        if (this->iters_no > 50)
+            throw std::runtime_error((std::string)__func__ + ": Zero rate for swap '" + this->generator->instr_nm + "' with tenor '" + tenor + "' did not converge!");
+
+        // fixed leg annuity
+        double annuity = this->fix_leg.pv_done;
+        double annuity_deriv = 0.0;
+        for (std::size_t idx = this->fix_leg.cpns_done_no; idx < fix_cpns_no; idx++)
+        {
+            auto [df, df_deriv] = get_dsc_df_deriv(this->fix_leg.yr_fracs[idx], zr_node);
+            annuity += this->fix_leg.yr_fracs_acr[idx] * df;
+            annuity_deriv += this->fix_leg.yr_fracs_acr[idx] * df_deriv;
+        }
+        auto [df_end, df_end_deriv] = get_dsc_df_deriv(swp.fix_yr_frac_end, zr_node);
+        annuity += swp.fix_yr_frac_acr_end * df_end;
+        annuity_deriv += swp.fix_yr_frac_acr_end * df_end_deriv;
+
+        // floating leg present value
+        double flt_pv = this->flt_leg.pv_done;
+        double flt_pv_deriv = 0.0;
+        for (std::size_t idx = this->flt_leg.cpns_done_no; idx < flt_cpns_no; idx++)
+        {
+            double yr_frac_begin = (idx == 0) ? this->flt_leg.yr_frac_spot : this->flt_leg.yr_fracs[idx - 1];
+            auto [pv, pv_deriv] = get_flt_pv_deriv(yr_frac_begin, this->flt_leg.yr_fracs[idx], zr_node);
+            flt_pv += pv;
+            flt_pv_deriv += pv_deriv;
+        }
+        auto [pv_end, pv_end_deriv] = get_flt_pv_deriv(swp.flt_yr_frac_begin_end, swp.flt_yr_frac_end, zr_node);
+        flt_pv += pv_end;
+        flt_pv_deriv += pv_end_deriv;
+
+        // Newton-Raphson step
+        double step = (par_rate * annuity - flt_pv) / (par_rate * annuity_deriv - flt_pv_deriv);
+        zr_node -= step;
+        if (std::abs(step) < 1e-14)
+            break;
+    }
+
+    // calibration equation
+    this->eq = this->build_calib_eq(swp, par_rate);
+
+    // return maturity year fraction and zero rate
+    return {yr_frac_node, zr_node};
+}
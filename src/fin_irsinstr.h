@@ -0,0 +1,165 @@
+/** \example fin_irsinstr_examples.h
+ * @file fin_irsinstr.h
+ * @author Michal Mackanic
+ * @brief Implement interest rate swap instrument.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+# pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <memory>
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_generators.h"
+#include "fin_calibration.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Leg of an interest rate swap. Regular coupon dates and, if swaps are discounted by a known curve, their discount factors are shared by all swaps
+     * of a strip and they are generated only once.
+     *
+     */
+    struct irs_leg
+    {
+        lib_date::myDate date_spot;
+        double yr_frac_spot;
+        std::tuple<int, std::string> freq;
+        std::vector<lib_date::myDate> dates;
+        std::vector<double> yr_fracs;
+        std::vector<double> yr_fracs_acr;
+        std::vector<double> dfs_dsc;
+        std::size_t cpns_done_no;
+        double pv_done;
+    };
+
+    /**
+     * @brief Schedule of a single swap of a strip, i.e. number of its regular coupons and its last coupons ending at swap maturity.
+     *
+     */
+    struct irs_swp
+    {
+        std::size_t fix_cpns_no;
+        std::size_t flt_cpns_no;
+        double fix_yr_frac_end;
+        double fix_yr_frac_acr_end;
+        double fix_df_dsc_end;
+        double flt_yr_frac_begin_end;
+        double flt_yr_frac_end;
+        double flt_df_dsc_end;
+        double yr_frac_node;
+    };
+
+    /**
+     * @brief Object evaluating strip of interest rate swaps sharing the same generator, i.e. swaps are solved one by one in the order of their tenors. Coupons
+     * preceding the last node of the underlying zero rate curve are valued only once and their present values are reused by the subsequent swaps of the strip,
+     * so the whole strip is solved in linear time. The underlying zero rate curve is not modified; the result has to be added to the curve by the caller.
+     *
+     */
+    class myIrsInstr
+    {
+        private:
+            lib_date::myDate date_exec;
+            std::shared_ptr<fin_curves::generator> generator;
+            std::shared_ptr<fin_curves::myZeroRate> dsc_crv;
+            const std::vector<lib_date::myDate>* holidays_fix_pmt;
+            const std::vector<lib_date::myDate>* holidays_flt_pmt;
+            fin_curves::irs_leg fix_leg;
+            fin_curves::irs_leg flt_leg;
+            std::string zr_dcm;
+            int zr_type;
+            double yr_frac_last;
+            std::size_t iters_no;
+            fin_curves::calib_eq eq;
+
+            /**
+             * @brief Generate regular coupon dates of a leg up to a specified number of coupons.
+             *
+             * @param leg Leg to be extended.
+             * @param cpns_no Number of regular coupons the leg should have.
+             * @param cal Payment calendar name; coupon dates are taken from schedules cached per thread, see fin_date::get_cpn_dates().
+             * @param dcm Day count method of coupon accruals.
+             */
+            void extend_leg(fin_curves::irs_leg& leg, const std::size_t& cpns_no, const std::string& cal, const std::string& dcm);
+
+            /**
+             * @brief Generate schedule of a swap of the strip; missing regular coupons are added to the legs.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @return fin_curves::irs_swp Swap schedule.
+             */
+            fin_curves::irs_swp get_swp(const std::string& tenor);
+
+            /**
+             * @brief Build calibration equation of a swap of the strip.
+             *
+             * @param swp Swap schedule.
+             * @param par_rate Swap rate.
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq build_calib_eq(const fin_curves::irs_swp& swp, const double& par_rate) const;
+
+        public:
+            /**
+             * @brief Construct a new myIrsInstr object, i.e. an empty strip of interest rate swaps.
+             *
+             * @param date Execution date from which swap maturities are derived using tenor information.
+             * @param generator Generator with definitions needed to evaluate interest rate swaps.
+             * @param crv Zero rate curve to be bootstrapped; it defines day count method and zero rate type of the solved nodes.
+             * @param dsc_crv Zero rate curve used to discount swap cash flows; nullptr => cash flows are discounted by the curve being bootstrapped.
+             * @param date_format Date format.
+             */
+            myIrsInstr(const std::string& date, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, const std::shared_ptr<fin_curves::myZeroRate>& dsc_crv = nullptr, std::string date_format = "yyyymmdd");
+
+            /**
+             * @brief Solve zero rate of the next swap of the strip using Newton-Raphson method with analytic derivative. Swaps have to be solved in the order of
+             * their tenors and nodes of the zero rate curve must not be modified between two calls except for adding new nodes.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @param par_rate Swap rate quoted on market for the respective tenor as of execution date.
+             * @param crv Zero rate curve being bootstrapped holding nodes solved so far; the swap maturity node follows its last node.
+             * @return std::tuple<double, double> Maturity year fraction and zero rate following convention of the zero rate curve.
+             */
+            std::tuple<double, double> solve(const std::string& tenor, const double& par_rate, const fin_curves::myZeroRate& crv);
+
+            /**
+             * @brief Get number of Newton-Raphson iterations needed to solve the last swap.
+             *
+             * @return std::size_t Number of iterations.
+             */
+            std::size_t get_iters_no() const {return this->iters_no;};
+
+            /**
+             * @brief Get calibration equation of the last solved swap, i.e. par rate * annuity - floating leg present value = 0.
+             *
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq() const {return this->eq;};
+
+            /**
+             * @brief Get calibration equation of any swap of the strip for a provided swap rate without solving it; regular coupons generated for the
+             * preceding swaps are reused.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @param par_rate Swap rate.
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq(const std::string& tenor, const double& par_rate);
+
+            /**
+             * @brief Get year fraction of the curve node of any swap of the strip without solving it, i.e. year fraction of the swap maturity; regular coupons
+             * generated for the preceding swaps are reused.
+             *
+             * @param tenor Frequency string defining swap maturity, e.g. "2Y", "27M".
+             * @return double Year fraction of the curve node.
+             */
+            double get_yr_frac_node(const std::string& tenor) {return this->get_swp(tenor).yr_frac_node;};
+    };
+}
@@ -0,0 +1,262 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <vector>
+#include <map>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include "lib_aux.h"
+#include "lib_date.h"
+#include "lib_file.h"
+#include "fin_bootstrap.h"
+#include "fin_keyrates.h"
+
+// evaluate bucketed DV01 of a portfolio
+std::size_t fin_curves::myKeyRates::run(const fin_curves::myScheduler& scheduler, const std::string& date, const fin_curves::pricer& value, const double& bump, const std::size_t& threads_no, const std::string& date_format)
+{
+    // convert date to yyyymmdd if necessary
+    std::string date_str = date;
+    if (date_format.compare("yyyymmdd") != 0)
+    {
+        lib_date::myDate date_aux(date, date_format);
+        date_str = date_aux.get_date_str();
+    }
+    this->date = date_str;
+    this->bump = bump;
+
+    // curves bootstrapped by the scheduler are valued as they are
+    this->crv_nms = scheduler.get_crv_nms();
+    std::vector<std::string> scheduler_errs = scheduler.get_errs();
+    std::size_t crvs_no = this->crv_nms.size();
+    this->errs.assign(crvs_no, "");
+    std::map<std::string, std::shared_ptr<const fin_curves::myZeroRate>> crvs_base;
+    for (std::size_t idx = 0; idx < crvs_no; idx++)
+    {
+        if ((scheduler_errs.size() == crvs_no) && (scheduler_errs[idx].size() == 0))
+            crvs_base[this->crv_nms[idx]] = scheduler.get_crv(this->crv_nms[idx])->freeze();
+        else
+            this->errs[idx] = (std::string)__func__ + ": Curve '" + this->crv_nms[idx] + "' was not bootstrapped!";
+    }
+    this->pv = value(crvs_base);
+
+    // each pillar is bumped separately; bucket of a pillar is its tenor and buckets are sorted by maturity of the curve nodes
+    std::vector<std::tuple<std::size_t, std::size_t>> bumps;
+    std::vector<std::vector<std::string>> tenors(crvs_no);
+    std::map<std::string, double> buckets_yr_fracs;
+    for (std::size_t idx = 0; idx < crvs_no; idx++)
+    {
+        if (this->errs[idx].size() > 0)
+            continue;
+
+        try
+        {
+            std::vector<fin_curves::pillar> pillars = scheduler.get_bootstrap(this->crv_nms[idx], date_str)->get_pillars();
+            std::vector<double> yr_fracs = crvs_base.at(this->crv_nms[idx])->get_yr_fracs();
+            if (yr_fracs.size() != pillars.size())
+                throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nms[idx] + "' does not match its quotes as of " + date_str + "!");
+
+            for (std::size_t pillar_idx = 0; pillar_idx < pillars.size(); pillar_idx++)
+            {
+                bumps.push_back({idx, pillar_idx});
+                tenors[idx].push_back(pillars[pillar_idx].tenor);
+                auto bucket = buckets_yr_fracs.find(pillars[pillar_idx].tenor);
+                if (bucket == buckets_yr_fracs.end())
+                    buckets_yr_fracs[pillars[pillar_idx].tenor] = yr_fracs[pillar_idx];
+                else
+                    bucket->second = std::min(bucket->second, yr_fracs[pillar_idx]);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->errs[idx] = e.what();
+        }
+    }
+    this->buckets.clear();
+    for (const auto& [bucket, yr_frac] : buckets_yr_fracs)
+        this->buckets.push_back(bucket);
+    std::sort(this->buckets.begin(), this->buckets.end(), [&](const std::string& bucket1, const std::string& bucket2) {return buckets_yr_fracs[bucket1] < buckets_yr_fracs[bucket2];});
+
+    // number of worker threads
+    std::vector<double> dv01s_bump(bumps.size(), 0.0);
+    std::vector<std::string> errs_bump(bumps.size(), "");
+    std::size_t workers_no = (threads_no > 0) ? threads_no : std::max(1u, std::thread::hardware_concurrency());
+    workers_no = std::max((std::size_t)1, std::min(workers_no, bumps.size()));
+
+    // worker processes a contiguous block of bumps, i.e. mostly pillars of the same curve, so its bootstraps are run once and then only updated; each
+    // bootstrap shares curves of the worker's bootstraps of its scheduled input curves, so that curves depending on the bumped curve are refreshed against
+    // the bumped curve. All curves are restored from their states saved after the bootstrap, i.e. they do not drift with the number of bumps
+    auto worker = [&](const int& idx_begin, const int& idx_end)
+    {
+        std::map<std::string, std::shared_ptr<fin_curves::myBootstrap>> bootstraps;
+        std::map<std::string, fin_curves::bootstrap_state> states;
+        std::map<std::string, std::shared_ptr<const fin_curves::myZeroRate>> crvs = crvs_base;
+
+        // unbumped value uses curves of the worker's bootstraps in the states they are restored to after each bump, so the bump is the only difference
+        // between both values; it is evaluated again only when a new bootstrap replaces the scheduler's curve
+        double pv_base = 0.0;
+        bool is_pv_base = false;
+
+        std::function<std::shared_ptr<fin_curves::myBootstrap>(const std::string&)> get_bootstrap = [&](const std::string& crv_nm) -> std::shared_ptr<fin_curves::myBootstrap>
+        {
+            auto bootstrap = bootstraps.find(crv_nm);
+            if (bootstrap != bootstraps.end())
+                return bootstrap->second;
+
+            std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>> crvs_input;
+            for (const std::string& input_nm : scheduler.get_inputs(crv_nm))
+                crvs_input[input_nm] = get_bootstrap(input_nm)->get_crv();
+            std::shared_ptr<fin_curves::myBootstrap> bootstrap_crv = scheduler.get_bootstrap(crv_nm, date_str, crvs_input);
+            bootstrap_crv->run();
+            bootstraps[crv_nm] = bootstrap_crv;
+            states[crv_nm] = bootstrap_crv->get_state();
+            if (crvs_base.find(crv_nm) != crvs_base.end())
+            {
+                crvs[crv_nm] = bootstrap_crv->get_crv();
+                is_pv_base = false;
+            }
+            return bootstrap_crv;
+        };
+
+        for (int idx = idx_begin; idx <= idx_end; idx++)
+        {
+            const auto& [crv_idx, pillar_idx] = bumps[idx];
+            const std::string& crv_nm = this->crv_nms[crv_idx];
+            std::vector<std::string> dependents;
+            try
+            {
+                // curves depending on the bumped curve which were bootstrapped by the scheduler; their bootstraps exist before the bump
+                std::shared_ptr<fin_curves::myBootstrap> bootstrap = get_bootstrap(crv_nm);
+                for (const std::string& dependent_nm : scheduler.get_dependents(crv_nm))
+                {
+                    if (crvs_base.find(dependent_nm) == crvs_base.end())
+                        continue;
+                    get_bootstrap(dependent_nm);
+                    dependents.push_back(dependent_nm);
+                }
+                if (!is_pv_base)
+                {
+                    pv_base = value(crvs);
+                    is_pv_base = true;
+                }
+
+                // curves of the bootstraps are updated in place by the bump; dependents follow their inputs in the order of dependencies, so each of them
+                // re-solves only pillars maturing after the first change of its bumped or refreshed inputs
+                double quote = *bootstrap->get_pillars()[pillar_idx].quote;
+                bootstrap->update(pillar_idx, quote + bump);
+                std::map<std::string, double> yr_fracs_same = {{crv_nm, bootstrap->get_yr_frac_same(states.at(crv_nm))}};
+                for (const std::string& dependent_nm : dependents)
+                {
+                    double yr_frac_same = std::numeric_limits<double>::infinity();
+                    for (const std::string& input_nm : scheduler.get_inputs(dependent_nm))
+                    {
+                        auto input = yr_fracs_same.find(input_nm);
+                        if (input != yr_fracs_same.end())
+                            yr_frac_same = std::min(yr_frac_same, input->second);
+                    }
+                    std::shared_ptr<fin_curves::myBootstrap> bootstrap_dependent = bootstraps.at(dependent_nm);
+                    bootstrap_dependent->refresh(yr_frac_same);
+                    yr_fracs_same[dependent_nm] = bootstrap_dependent->get_yr_frac_same(states.at(dependent_nm));
+                }
+                dv01s_bump[idx] = value(crvs) - pv_base;
+
+                bootstrap->set_state(states.at(crv_nm));
+                for (const std::string& dependent_nm : dependents)
+                    bootstraps.at(dependent_nm)->set_state(states.at(dependent_nm));
+            }
+            catch (const std::exception& e)
+            {
+                // bootstraps share their curves, so all of them are bootstrapped again by the next bump
+                errs_bump[idx] = e.what();
+                crvs = crvs_base;
+                bootstraps.clear();
+                states.clear();
+                is_pv_base = false;
+            }
+        }
+    };
+
+    if (bumps.size() > 0)
+    {
+        std::vector<std::thread> workers;
+        for (lib_aux::coordinates<int> block : lib_aux::split_vector(bumps.size(), (int)workers_no))
+            workers.push_back(std::thread(worker, block.x, block.y));
+        for (std::thread& thread : workers)
+            thread.join();
+    }
+
+    // collect DV01 of pillars into buckets; curve fails if any of its bumps failed
+    this->dv01s.assign(this->buckets.size(), std::vector<double>(crvs_no, 0.0));
+    for (std::size_t idx = 0; idx < bumps.size(); idx++)
+    {
+        const auto& [crv_idx, pillar_idx] = bumps[idx];
+        if ((errs_bump[idx].size() > 0) && (this->errs[crv_idx].size() == 0))
+            this->errs[crv_idx] = errs_bump[idx];
+        std::size_t bucket_idx = std::find(this->buckets.begin(), this->buckets.end(), tenors[crv_idx][pillar_idx]) - this->buckets.begin();
+        this->dv01s[bucket_idx][crv_idx] += dv01s_bump[idx];
+    }
+    for (std::size_t crv_idx = 0; crv_idx < crvs_no; crv_idx++)
+    {
+        if (this->errs[crv_idx].size() == 0)
+            continue;
+        for (std::vector<double>& dv01s_bucket : this->dv01s)
+            dv01s_bucket[crv_idx] = 0.0;
+    }
+
+    // return number of curves with evaluated DV01
+    return std::count(this->errs.begin(), this->errs.end(), "");
+}
+
+// get key rate durations
+std::vector<std::vector<double>> fin_curves::myKeyRates::get_krds() const
+{
+    std::vector<std::vector<double>> krds = this->dv01s;
+    for (std::vector<double>& krds_bucket : krds)
+    {
+        for (double& krd : krds_bucket)
+            krd = (this->pv == 0.0) ? 0.0 : -krd / (this->pv * this->bump);
+    }
+    return krds;
+}
+
+// save bucket x curve matrices
+void fin_curves::myKeyRates::save() const
+{
+    std::string folder_nm = this->path + "outputs/risk/";
+    if (!lib_file::path_exists(folder_nm))
+        lib_file::create_folder(folder_nm);
+
+    // name of this function for error messages raised inside the lambda
+    const std::string func_nm = __func__;
+
+    auto save_mtrx = [&](const std::string& file_nm, const std::vector<std::vector<double>>& mtrx)
+    {
+        std::ofstream myfile(file_nm);
+        if (!myfile.is_open())
+            throw std::runtime_error(func_nm + ": cannot open file '" + file_nm + "'!");
+
+        // write headers
+        myfile << "bucket";
+        for (const std::string& crv_nm : this->crv_nms)
+            myfile << this->sep << crv_nm;
+        myfile << '\n';
+
+        // add data
+        myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (std::size_t idx = 0; idx < this->buckets.size(); idx++)
+        {
+            myfile << this->buckets[idx];
+            for (double element : mtrx[idx])
+                myfile << this->sep << element;
+            myfile << '\n';
+        }
+
+        // close file
+        myfile.close();
+    };
+
+    save_mtrx(folder_nm + "dv01_" + this->date + ".csv", this->dv01s);
+    save_mtrx(folder_nm + "krd_" + this->date + ".csv", this->get_krds());
+}
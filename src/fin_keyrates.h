@@ -0,0 +1,126 @@
+/** \example fin_keyrates_examples.h
+ * @file fin_keyrates.h
+ * @author Michal Mackanic
+ * @brief Bucketed DV01 and key rate durations of a portfolio with respect to market quotes of scheduled zero rate curves.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <memory>
+#include <functional>
+#include "fin_zerorate.h"
+#include "fin_scheduler.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Portfolio valuation given zero rate curves identified by their names; it is called concurrently by worker threads, so it must not change any
+     * shared state.
+     *
+     */
+    using pricer = std::function<double(const std::map<std::string, std::shared_ptr<const fin_curves::myZeroRate>>& crvs)>;
+
+    /**
+     * @brief Object evaluating bucketed DV01, i.e. change of portfolio value when a market quote of a curve is bumped, for all quotes of all curves
+     * bootstrapped by a scheduler. Buckets are tenors of the pillars, e.g. ON, TN, 1M, ..., 50Y; quotes of a curve with the same tenor fall into the same
+     * bucket. Bumped quote re-solves only the curve nodes affected by it and swap strips reuse their schedules, see myBootstrap::update(); scheduled curves
+     * depending on the bumped curve directly or through other curves, e.g. projection curves discounted by it, re-solve only nodes of pillars whose calibration
+     * equations changed with the bumped curve and the nodes depending on them, see myScheduler::get_dependents() and myBootstrap::refresh(). Bumps are split
+     * into contiguous blocks processed by worker threads and each thread keeps its own bootstraps of the curves it bumps, their dependents and their input
+     * curves; after each bump the curves are restored from states saved after their bootstrap, see myBootstrap::get_state(), so DV01 does not depend on the
+     * number of threads. Bumped value is compared with value of the same thread's curves before the bump, evaluated once for the thread's bootstraps, rather
+     * than with get_pv(), so differences between the thread's bootstraps and the scheduler's curves do not leak into DV01.
+     *
+     */
+    class myKeyRates
+    {
+        private:
+            std::string path;
+            std::string sep;
+            std::string date;
+            std::vector<std::string> crv_nms;
+            std::vector<std::string> buckets;
+            std::vector<std::vector<double>> dv01s;
+            double pv = 0.0;
+            double bump = 0.0001;
+            std::vector<std::string> errs;
+
+        public:
+            /**
+             * @brief Construct a new myKeyRates object.
+             *
+             * @param path Path to data folder; report is saved into its "outputs/risk/" subfolder.
+             * @param sep Column separator.
+             */
+            myKeyRates(const std::string& path, const std::string& sep = ",") : path(path), sep(sep) {};
+
+            /**
+             * @brief Evaluate bucketed DV01 of a portfolio for all curves successfully bootstrapped by the last run of a scheduler.
+             *
+             * @param scheduler Scheduler whose curves were bootstrapped as of the date.
+             * @param date Date of the market quotes.
+             * @param value Portfolio valuation.
+             * @param bump Bump of market quotes, e.g. 0.0001 for 1bp.
+             * @param threads_no Number of worker threads; 0 => number of hardware threads.
+             * @param date_format Format of the date.
+             * @return std::size_t Number of curves whose DV01 was evaluated; error messages of the other curves are available through get_errs().
+             */
+            std::size_t run(const fin_curves::myScheduler& scheduler, const std::string& date, const fin_curves::pricer& value, const double& bump = 0.0001, const std::size_t& threads_no = 0, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Get names of curves of the last run.
+             *
+             * @return std::vector<std::string> Curve names in the order of scheduling.
+             */
+            std::vector<std::string> get_crv_nms() const {return this->crv_nms;};
+
+            /**
+             * @brief Get buckets of the last run.
+             *
+             * @return std::vector<std::string> Tenors sorted by maturity.
+             */
+            std::vector<std::string> get_buckets() const {return this->buckets;};
+
+            /**
+             * @brief Get bucketed DV01 of the last run.
+             *
+             * @return std::vector<std::vector<double>> Matrix of DV01; element [i][j] is change of portfolio value when quotes of bucket i of curve j are bumped.
+             */
+            std::vector<std::vector<double>> get_dv01s() const {return this->dv01s;};
+
+            /**
+             * @brief Get key rate durations of the last run, i.e. -DV01 / (portfolio value * bump).
+             *
+             * @return std::vector<std::vector<double>> Matrix of key rate durations with the same layout as get_dv01s().
+             */
+            std::vector<std::vector<double>> get_krds() const;
+
+            /**
+             * @brief Get portfolio value using the bootstrapped curves.
+             *
+             * @return double Portfolio value.
+             */
+            double get_pv() const {return this->pv;};
+
+            /**
+             * @brief Get error messages of curves of the last run.
+             *
+             * @return std::vector<std::string> Error messages in the order of curves; "" => DV01 of the curve was evaluated.
+             */
+            std::vector<std::string> get_errs() const {return this->errs;};
+
+            /**
+             * @brief Save bucket x curve matrix of DV01 and key rate durations into "outputs/risk/" subfolder of the data folder.
+             *
+             */
+            void save() const;
+    };
+}
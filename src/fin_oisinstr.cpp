@@ -0,0 +1,173 @@
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <cmath>
+#include "fin_date.h"
+#include "fin_curves.h"
+#include "fin_zerorate.h"
+#include "fin_oisinstr.h"
+
+fin_curves::myOisInstr::myOisInstr(const std::string& date, const std::string& tenor, const double& par_rate, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, std::string date_format)
+{
+    // check that the generator is OIS
+    if (generator->instr_tp.compare("ois") != 0)
+        throw std::runtime_error((std::string)__func__ + ": Instrument '" + generator->instr_nm + "' is not an OIS!");
+
+    // store par rate
+    this->par_rate = par_rate;
+
+    // get fixing and payment calendars
+    lib_date::myDate date_exec = lib_date::myDate(date, date_format);
+    std::size_t year_start = date_exec.get_year();
+    const std::vector<lib_date::myDate>& holidays_fix = fin_date::get_holidays(generator->instr_def.ois.cal_fix, year_start, year_start + 100);
+    const std::vector<lib_date::myDate>& holidays_pmt = fin_date::get_holidays(generator->instr_def.ois.cal_pmt, year_start, year_start + 100);
+
+    // determine spot date using fixing calendar
+    lib_date::myDate date_spot = date_exec;
+    if (generator->instr_def.ois.days_shift > 0)
+        date_spot.add_working_days(holidays_fix, generator->instr_def.ois.days_shift);
+
+    // express tenor and coupon period in months; -1 => tenor is given in days or weeks
+    auto get_months = [](const std::tuple<int, std::string>& freq) -> int
+    {
+        if (std::get<1>(freq).compare("Y") == 0)
+            return 12 * std::get<0>(freq);
+        else if (std::get<1>(freq).compare("M") == 0)
+            return std::get<0>(freq);
+        else
+            return -1;
+    };
+    std::tuple<int, std::string> freq_end = fin_date::decompose_freq(tenor);
+    std::tuple<int, std::string> freq_cpn = fin_date::decompose_freq(generator->instr_def.ois.simple_vs_compounding);
+    int months_end = get_months(freq_end);
+    int months_cpn = get_months(freq_cpn);
+
+    // generate coupon dates; OIS not longer than one coupon period pays single coupon at maturity; coupons roll forward from spot date, so a tenor that
+    // is not a multiple of the coupon period ends with a short back stub, e.g. 18M OIS with annual coupons pays after 12M and 18M
+    std::vector<lib_date::myDate> dates_cpn;
+    if ((months_end > 0) && (months_cpn > 0))
+    {
+        for (int cpn_no = 1; cpn_no * months_cpn < months_end; cpn_no++)
+        {
+            lib_date::myDate date_cpn = date_spot;
+            date_cpn.add(fin_date::compose_freq({cpn_no * std::get<0>(freq_cpn), std::get<1>(freq_cpn)}));
+            fin_date::date_rolling(date_cpn, holidays_pmt, generator->instr_def.ois.drm);
+            dates_cpn.push_back(date_cpn);
+        }
+    }
+    lib_date::myDate date_end = date_spot;
+    date_end.add(fin_date::compose_freq(freq_end));
+    fin_date::date_rolling(date_end, holidays_pmt, generator->instr_def.ois.drm);
+    dates_cpn.push_back(date_end);
+
+    // calculate year fractions of coupon dates following day count method of the underlying zero rate curve and fixed leg accrual year fractions
+    std::string zr_dcm = crv.get_def().zr_dcm;
+    int zr_type = crv.get_def().zr_type;
+    double yr_frac_spot = fin_date::day_count_method(date_exec, date_spot, zr_dcm);
+    std::vector<double> yr_fracs_cpn;
+    std::vector<double> yr_fracs_acr;
+    lib_date::myDate date_prev = date_spot;
+    for (lib_date::myDate date_cpn : dates_cpn)
+    {
+        yr_fracs_cpn.push_back(fin_date::day_count_method(date_exec, date_cpn, zr_dcm));
+        yr_fracs_acr.push_back(fin_date::day_count_method(date_prev, date_cpn, generator->instr_def.ois.fix_leg_dcm));
+        date_prev = date_cpn;
+    }
+    this->yr_frac_pmt = yr_fracs_cpn.back();
+
+    // calibration equation
+    for (std::size_t idx = 0; idx < yr_fracs_cpn.size(); idx++)
+    {
+        this->eq.dfs.push_back({this->par_rate * yr_fracs_acr[idx], yr_fracs_cpn[idx]});
+        this->eq.dfs_derivs.push_back(yr_fracs_acr[idx]);
+    }
+    this->eq.dfs.push_back({1.0, this->yr_frac_pmt});
+    this->eq.dfs.push_back({-1.0, yr_frac_spot});
+    this->eq.dfs_derivs.insert(this->eq.dfs_derivs.end(), {0.0, 0.0});
+
+    // discount factors preceding the last curve node are known; the remaining ones depend on the zero rate being solved for
+    std::size_t nodes_no = crv.get_size();
+    bool is_empty = (nodes_no == 0);
+    double yr_frac_last = is_empty ? 0.0 : crv.get_yr_frac(nodes_no - 1);
+    double zr_last = is_empty ? this->par_rate : crv.get_zr(nodes_no - 1);
+
+    // fixed leg annuity of coupons with known discount factors
+    std::size_t cpns_no = yr_fracs_cpn.size();
+    double annuity_known = 0.0;
+    std::vector<std::size_t> idxs_unknown;
+    for (std::size_t idx = 0; idx < cpns_no - 1; idx++)
+    {
+        if (!is_empty && (yr_fracs_cpn[idx] <= yr_frac_last))
+            annuity_known += yr_fracs_acr[idx] * crv.get_df(yr_fracs_cpn[idx]);
+        else
+            idxs_unknown.push_back(idx);
+    }
+
+    // discount factor as of spot date
+    bool is_spot_known = (yr_frac_spot == 0.0) || (!is_empty && (yr_frac_spot <= yr_frac_last));
+    double df_spot = 1.0;
+    if ((yr_frac_spot > 0.0) && is_spot_known)
+        df_spot = crv.get_df(yr_frac_spot);
+
+    // discount factor beyond the last curve node and its derivative with respect to the zero rate of the OIS maturity node; zero rates beyond the last
+    // curve node are linearly interpolated between the last node and the OIS maturity node
+    auto get_df_deriv = [&](const double& yr_frac, const double& zr_end) -> std::tuple<double, double>
+    {
+        double weight = is_empty ? 1.0 : (yr_frac - yr_frac_last) / (this->yr_frac_pmt - yr_frac_last);
+        double zr = zr_last + (zr_end - zr_last) * weight;
+        double df = fin_curves::zr_to_df(zr, yr_frac, zr_type);
+        double df_deriv = (zr_type == 0) ? -yr_frac * df / (1.0 + zr) * weight : -yr_frac * df * weight;
+        return {df, df_deriv};
+    };
+
+    // floating leg value is DF(spot) - DF(maturity) and fixed leg value is par rate times annuity, hence
+    // DF(maturity) = (DF(spot) - par rate * annuity excl. last coupon) / (1 + par rate * last accrual year fraction)
+    // if all coupon dates but the last one precede the last curve node; otherwise the maturity zero rate is solved using Newton-Raphson method
+    this->iters_no = 1;
+    if ((idxs_unknown.size() == 0) && is_spot_known)
+    {
+        this->df = (df_spot - this->par_rate * annuity_known) / (1.0 + this->par_rate * yr_fracs_acr[cpns_no - 1]);
+        this->zr = fin_curves::df_to_zr(this->df, this->yr_frac_pmt, zr_type);
+    }
+    else
+    {
+        this->zr = zr_last;
+        this->iters_no = 0;
+        while (true)
+        {
+            this->iters_no++;
+            if (this->iters_no > 50)
+                throw std::runtime_error((std::string)__func__ + ": Zero rate for OIS '" + generator->instr_nm + "' with tenor '" + tenor + "' did not converge!");
+
+            // fixed leg annuity
+            double annuity = annuity_known;
+            double annuity_deriv = 0.0;
+            for (std::size_t idx : idxs_unknown)
+            {
+                auto [df, df_deriv] = get_df_deriv(yr_fracs_cpn[idx], this->zr);
+                annuity += yr_fracs_acr[idx] * df;
+                annuity_deriv += yr_fracs_acr[idx] * df_deriv;
+            }
+            auto [df_end, df_end_deriv] = get_df_deriv(this->yr_frac_pmt, this->zr);
+            annuity += yr_fracs_acr[cpns_no - 1] * df_end;
+            annuity_deriv += yr_fracs_acr[cpns_no - 1] * df_end_deriv;
+
+            // floating leg present value
+            double flt_pv = df_spot - df_end;
+            double flt_pv_deriv = -df_end_deriv;
+            if (!is_spot_known)
+            {
+                auto [df_spot_aux, df_spot_deriv] = get_df_deriv(yr_frac_spot, this->zr);
+                flt_pv += df_spot_aux - df_spot;
+                flt_pv_deriv += df_spot_deriv;
+            }
+
+            // Newton-Raphson step
+            double step = (this->par_rate * annuity - flt_pv) / (this->par_rate * annuity_deriv - flt_pv_deriv);
+            this->zr -= step;
+            if (std::abs(step) < 1e-14)
+                break;
+        }
+        this->df = fin_curves::zr_to_df(this->zr, this->yr_frac_pmt, zr_type);
+    }
+}
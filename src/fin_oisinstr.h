@@ -0,0 +1,80 @@
+/** \example fin_oisinstr_examples.h
+ * @file fin_oisinstr.h
+ * @author Michal Mackanic
+ * @brief Implement OIS instrument.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+# pragma once
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <memory>
+#include "lib_date.h"
+#include "fin_zerorate.h"
+#include "fin_generators.h"
+#include "fin_calibration.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Object evaluating OIS instrument upon its creation. The compounded floating leg is valued through telescoping discount factor ratios, i.e. its value is DF(spot) - DF(maturity), so the evaluation costs O(coupons) rather than O(days). The underlying zero rate curve is not modified; the result has to be added to the curve by the caller.
+     *
+     */
+    class myOisInstr
+    {
+        private:
+            double yr_frac_pmt;
+            double par_rate;
+            double df;
+            double zr;
+            std::size_t iters_no;
+            fin_curves::calib_eq eq;
+
+        public:
+            /**
+             * @brief Construct a new myOisInstr object and evaluate OIS instrument, i.e. calculate its maturity year fraction, discount factor and zero rate.
+             *
+             * @param date Date from which OIS maturity is derived using tenor information.
+             * @param tenor Frequency string defining OIS maturity, e.g. "1W", "18M", "30Y".
+             * @param par_rate OIS rate quoted on market for the respective tenor as of execution date.
+             * @param generator Generator with definitions needed to evaluate OIS instrument; simple_vs_compounding defines coupon period, e.g. "1Y" => OIS up to one year pays single coupon at maturity, longer OIS pay annual coupons. Coupon dates are generated forward from spot date, so a tenor that is not a multiple of the coupon period ends with a short back stub, e.g. 18M OIS pays coupons after 12M and 18M.
+             * @param crv Zero rate curve providing discount factors for coupon dates preceding the last curve node. Discount factors beyond the last node are interpolated towards the OIS maturity node.
+             * @param date_format Date format.
+             */
+            myOisInstr(const std::string& date, const std::string& tenor, const double& par_rate, const std::shared_ptr<fin_curves::generator>& generator, const fin_curves::myZeroRate& crv, std::string date_format = "yyyymmdd");
+
+            /**
+             * @brief Get OIS maturity year fraction and zero rate following convention of the underlying zero rate curve.
+             *
+             * @return std::tuple<double, double> Maturity year fraction and zero rate.
+             */
+            std::tuple<double, double> get_yr_frac_zr() const {return {this->yr_frac_pmt, this->zr};};
+
+            /**
+             * @brief Get discount factor as of OIS maturity.
+             *
+             * @return double Discount factor.
+             */
+            double get_df() const {return this->df;};
+
+            /**
+             * @brief Get number of iterations needed to solve for the maturity zero rate; 1 => all coupon dates but the last one precede the last curve node.
+             *
+             * @return std::size_t Number of iterations.
+             */
+            std::size_t get_iters_no() const {return this->iters_no;};
+
+            /**
+             * @brief Get calibration equation of the OIS, i.e. par rate * annuity - (DF(spot) - DF(maturity)) = 0.
+             *
+             * @return fin_curves::calib_eq Calibration equation.
+             */
+            fin_curves::calib_eq get_calib_eq() const {return this->eq;};
+    };
+}
@@ -0,0 +1,336 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <filesystem>
+#include <cmath>
+#include <tuple>
+#include "lib_aux.h"
+#include "lib_date.h"
+#include "lib_file.h"
+#include "lib_mtrx.h"
+#include "fin_zerorate.h"
+#include "fin_pca.h"
+
+// find dates of saved curves within a date range
+std::vector<std::string> fin_curves::myPca::find_dates(const std::string& date_from, const std::string& date_to, const std::string& date_format) const
+{
+    // convert dates to yyyymmdd so that they could be compared as strings
+    std::string date_from_str = lib_date::myDate(date_from, date_format).get_date_str();
+    std::string date_to_str = lib_date::myDate(date_to, date_format).get_date_str();
+
+    // curve files are named after curve and date, e.g. "eur_ri_ester_20220429.csv"; time-stamped copies are skipped
+    std::string prefix = this->crv_nm + "_";
+    std::string suffix = ".csv";
+    std::vector<std::string> dates;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(this->path + "outputs/curves/"))
+    {
+        if (!entry.is_regular_file())
+            continue;
+
+        std::string file_nm = entry.path().filename().string();
+        if ((file_nm.size() != prefix.size() + 8 + suffix.size()) || (file_nm.compare(0, prefix.size(), prefix) != 0) || (file_nm.compare(file_nm.size() - suffix.size(), suffix.size(), suffix) != 0))
+            continue;
+
+        std::string date = file_nm.substr(prefix.size(), 8);
+        if (!std::all_of(date.begin(), date.end(), [](const char& c) {return std::isdigit(c);}))
+            continue;
+
+        if ((date.compare(date_from_str) >= 0) && (date.compare(date_to_str) <= 0))
+            dates.push_back(date);
+    }
+
+    // return sorted dates
+    std::sort(dates.begin(), dates.end());
+    return dates;
+}
+
+// load history of zero rates from saved curves
+std::size_t fin_curves::myPca::load(const std::string& date_from, const std::string& date_to, const std::vector<double>& yr_fracs, const std::size_t& threads_no, const std::string& date_format)
+{
+    if (yr_fracs.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Tenor grid is empty!");
+
+    // find dates to be loaded
+    this->dates = this->find_dates(date_from, date_to, date_format);
+    this->yr_fracs = yr_fracs;
+    this->zrs.assign(this->dates.size(), std::vector<double>(yr_fracs.size(), 0.0));
+    this->errs.assign(this->dates.size(), "");
+    if (this->dates.size() == 0)
+        return 0;
+
+    // number of worker threads
+    std::size_t workers_no = (threads_no > 0) ? threads_no : std::max(1u, std::thread::hardware_concurrency());
+    workers_no = std::min(workers_no, this->dates.size());
+
+    // worker loads a contiguous block of dates into its own curve; each date writes only its own zero rates and its own error message
+    auto worker = [&](const int& idx_begin, const int& idx_end)
+    {
+        std::shared_ptr<fin_curves::myZeroRate> crv;
+        try
+        {
+            crv = std::make_shared<fin_curves::myZeroRate>(this->path, this->crv_nm, this->sep, this->quotes);
+        }
+        catch (const std::exception& e)
+        {
+            for (int idx = idx_begin; idx <= idx_end; idx++)
+                this->errs[idx] = e.what();
+            return;
+        }
+
+        for (int idx = idx_begin; idx <= idx_end; idx++)
+        {
+            try
+            {
+                crv->load(this->dates[idx], "yyyymmdd", this->sep, this->quotes);
+                for (std::size_t tenor = 0; tenor < this->yr_fracs.size(); tenor++)
+                    this->zrs[idx][tenor] = crv->get_zr(this->yr_fracs[tenor]);
+            }
+            catch (const std::exception& e)
+            {
+                this->errs[idx] = e.what();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (lib_aux::coordinates<int> block : lib_aux::split_vector(this->dates.size(), (int)workers_no))
+        workers.push_back(std::thread(worker, block.x, block.y));
+    for (std::thread& thread : workers)
+        thread.join();
+
+    // return number of loaded dates
+    return std::count(this->errs.begin(), this->errs.end(), "");
+}
+
+// load history of zero rates directly
+void fin_curves::myPca::load(const std::vector<std::string>& dates, const std::vector<double>& yr_fracs, const std::vector<std::vector<double>>& zrs)
+{
+    if (yr_fracs.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Tenor grid is empty!");
+    if (dates.size() != zrs.size())
+        throw std::runtime_error((std::string)__func__ + ": Number of dates does not match number of curves!");
+    for (const std::vector<double>& zrs_date : zrs)
+    {
+        if (zrs_date.size() != yr_fracs.size())
+            throw std::runtime_error((std::string)__func__ + ": Number of zero rates does not match number of year fractions!");
+    }
+
+    this->dates = dates;
+    this->yr_fracs = yr_fracs;
+    this->zrs = zrs;
+    this->errs.assign(dates.size(), "");
+}
+
+// evaluate covariance matrix of daily changes
+void fin_curves::myPca::set_cov(const std::size_t& threads_no)
+{
+    // centered daily changes are stored row by row in a single block
+    std::size_t days_no = this->chgs.size();
+    std::size_t tenors_no = this->yr_fracs.size();
+    std::vector<double> chgs_ctr(days_no * tenors_no);
+    for (std::size_t day = 0; day < days_no; day++)
+    {
+        for (std::size_t tenor = 0; tenor < tenors_no; tenor++)
+            chgs_ctr[day * tenors_no + tenor] = this->chgs[day][tenor] - this->means[tenor];
+    }
+
+    // number of worker threads
+    std::size_t workers_no = (threads_no > 0) ? threads_no : std::max(1u, std::thread::hardware_concurrency());
+    workers_no = std::min(workers_no, days_no);
+
+    // worker sums upper triangle of its own covariance matrix over a contiguous block of days; days are processed in blocks that stay in cache while all
+    // tiles of the covariance matrix are updated and a tile stays in cache while it is updated by all days of the block
+    const std::size_t days_block = 64;
+    const std::size_t tenors_tile = 32;
+    std::vector<std::vector<double>> covs(workers_no, std::vector<double>(tenors_no * tenors_no, 0.0));
+    auto worker = [&](const std::size_t& worker_idx, const int& idx_begin, const int& idx_end)
+    {
+        double* cov_ptr = covs[worker_idx].data();
+        for (std::size_t day_lo = idx_begin; day_lo <= (std::size_t)idx_end; day_lo += days_block)
+        {
+            std::size_t day_hi = std::min(day_lo + days_block, (std::size_t)idx_end + 1);
+            for (std::size_t row_lo = 0; row_lo < tenors_no; row_lo += tenors_tile)
+            {
+                std::size_t row_hi = std::min(row_lo + tenors_tile, tenors_no);
+                for (std::size_t col_lo = row_lo; col_lo < tenors_no; col_lo += tenors_tile)
+                {
+                    std::size_t col_hi = std::min(col_lo + tenors_tile, tenors_no);
+                    for (std::size_t day = day_lo; day < day_hi; day++)
+                    {
+                        const double* chgs_ptr = chgs_ctr.data() + day * tenors_no;
+                        for (std::size_t row = row_lo; row < row_hi; row++)
+                        {
+                            double chg = chgs_ptr[row];
+                            double* cov_row = cov_ptr + row * tenors_no;
+                            for (std::size_t col = std::max(row, col_lo); col < col_hi; col++)
+                                cov_row[col] += chg * chgs_ptr[col];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    if (workers_no == 1)
+        worker(0, 0, days_no - 1);
+    else
+    {
+        std::vector<std::thread> workers;
+        std::size_t worker_idx = 0;
+        for (lib_aux::coordinates<int> block : lib_aux::split_vector(days_no, (int)workers_no))
+            workers.push_back(std::thread(worker, worker_idx++, block.x, block.y));
+        for (std::thread& thread : workers)
+            thread.join();
+    }
+
+    // sum covariance matrices of workers and mirror the upper triangle
+    this->cov.assign(tenors_no, std::vector<double>(tenors_no, 0.0));
+    for (std::size_t row = 0; row < tenors_no; row++)
+    {
+        for (std::size_t col = row; col < tenors_no; col++)
+        {
+            double cov = 0.0;
+            for (const std::vector<double>& cov_worker : covs)
+                cov += cov_worker[row * tenors_no + col];
+            this->cov[row][col] = cov / (double)(days_no - 1);
+            this->cov[col][row] = this->cov[row][col];
+        }
+    }
+}
+
+// decompose daily changes into principal components
+void fin_curves::myPca::run(const std::size_t& threads_no)
+{
+    // daily changes are taken between consecutive loaded dates
+    std::size_t tenors_no = this->yr_fracs.size();
+    this->chgs.clear();
+    std::size_t idx_prev = this->dates.size();
+    for (std::size_t idx = 0; idx < this->dates.size(); idx++)
+    {
+        if (this->errs[idx].size() > 0)
+            continue;
+
+        if (idx_prev < this->dates.size())
+        {
+            std::vector<double> chgs_day(tenors_no);
+            for (std::size_t tenor = 0; tenor < tenors_no; tenor++)
+                chgs_day[tenor] = this->zrs[idx][tenor] - this->zrs[idx_prev][tenor];
+            this->chgs.push_back(chgs_day);
+        }
+        idx_prev = idx;
+    }
+    if (this->chgs.size() < 2)
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nm + "' - at least two daily changes are required!");
+
+    // mean daily changes
+    this->means.assign(tenors_no, 0.0);
+    for (const std::vector<double>& chgs_day : this->chgs)
+    {
+        for (std::size_t tenor = 0; tenor < tenors_no; tenor++)
+            this->means[tenor] += chgs_day[tenor];
+    }
+    for (double& mean : this->means)
+        mean /= (double)this->chgs.size();
+
+    // covariance matrix and its eigenvalues and eigenvectors
+    this->set_cov(threads_no);
+    std::shared_ptr<lib_mtrx::myMatrix2D> eig_vecs;
+    std::tie(this->eig_vals, eig_vecs) = lib_mtrx::sym_eig(std::make_shared<lib_mtrx::myMatrix2D>(this->cov));
+
+    // eigenvectors are stored by component; sign is fixed by the largest loading
+    this->eig_vecs = eig_vecs->transpose()->elements;
+    for (std::size_t comp = 0; comp < tenors_no; comp++)
+    {
+        std::size_t tenor_max = 0;
+        for (std::size_t tenor = 0; tenor < tenors_no; tenor++)
+        {
+            if (std::abs(this->eig_vecs[comp][tenor]) > std::abs(this->eig_vecs[comp][tenor_max]))
+                tenor_max = tenor;
+        }
+        if (this->eig_vecs[comp][tenor_max] < 0.0)
+        {
+            for (double& loading : this->eig_vecs[comp])
+                loading = -loading;
+        }
+    }
+}
+
+// get leading principal components
+std::vector<std::vector<double>> fin_curves::myPca::get_eig_vecs(const std::size_t& comps_no) const
+{
+    std::size_t comps_no_aux = ((comps_no == 0) || (comps_no > this->eig_vecs.size())) ? this->eig_vecs.size() : comps_no;
+    return std::vector<std::vector<double>>(this->eig_vecs.begin(), this->eig_vecs.begin() + comps_no_aux);
+}
+
+// get share of explained variance
+std::vector<double> fin_curves::myPca::get_explained() const
+{
+    // eigenvalues of a covariance matrix are non-negative up to rounding
+    double var = 0.0;
+    for (double eig_val : this->eig_vals)
+        var += std::max(eig_val, 0.0);
+
+    std::vector<double> explained;
+    for (double eig_val : this->eig_vals)
+        explained.push_back((var == 0.0) ? 0.0 : std::max(eig_val, 0.0) / var);
+    return explained;
+}
+
+// get scores of daily changes
+std::vector<std::vector<double>> fin_curves::myPca::get_scores(const std::size_t& comps_no) const
+{
+    std::vector<std::vector<double>> eig_vecs = this->get_eig_vecs(comps_no);
+    std::vector<std::vector<double>> scores(this->chgs.size(), std::vector<double>(eig_vecs.size(), 0.0));
+    for (std::size_t day = 0; day < this->chgs.size(); day++)
+    {
+        for (std::size_t comp = 0; comp < eig_vecs.size(); comp++)
+        {
+            for (std::size_t tenor = 0; tenor < this->yr_fracs.size(); tenor++)
+                scores[day][comp] += (this->chgs[day][tenor] - this->means[tenor]) * eig_vecs[comp][tenor];
+        }
+    }
+    return scores;
+}
+
+// save principal components
+void fin_curves::myPca::save(const std::size_t& comps_no) const
+{
+    if (this->eig_vecs.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + this->crv_nm + "' - principal components were not evaluated!");
+
+    std::string folder_nm = this->path + "outputs/risk/";
+    if (!lib_file::path_exists(folder_nm))
+        lib_file::create_folder(folder_nm);
+
+    // file is named after curve and the last date of the history
+    std::string file_nm = folder_nm + "pca_" + this->crv_nm + "_" + this->dates.back() + ".csv";
+    std::ofstream myfile(file_nm);
+    if (!myfile.is_open())
+        throw std::runtime_error((std::string)__func__ + ": cannot open file '" + file_nm + "'!");
+
+    // write headers
+    myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
+    myfile << "comp" << this->sep << "eig_val" << this->sep << "explained";
+    for (double yr_frac : this->yr_fracs)
+        myfile << this->sep << yr_frac;
+    myfile << '\n';
+
+    // add data
+    std::vector<std::vector<double>> eig_vecs = this->get_eig_vecs(comps_no);
+    std::vector<double> explained = this->get_explained();
+    for (std::size_t comp = 0; comp < eig_vecs.size(); comp++)
+    {
+        myfile << comp + 1 << this->sep << this->eig_vals[comp] << this->sep << explained[comp];
+        for (double loading : eig_vecs[comp])
+            myfile << this->sep << loading;
+        myfile << '\n';
+    }
+
+    // close file
+    myfile.close();
+}
@@ -0,0 +1,173 @@
+/** \example fin_pca_examples.h
+ * @file fin_pca.h
+ * @author Michal Mackanic
+ * @brief Principal component analysis of historical daily changes of a zero rate curve.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <memory>
+
+namespace fin_curves
+{
+    /**
+     * @brief Object decomposing historical daily changes of a zero rate curve into principal components, e.g. level, slope and curvature. Curves saved in
+     * "outputs/curves/" subfolder of the data folder are loaded onto a common tenor grid, daily changes between consecutive dates are centered and their
+     * covariance matrix is decomposed by lib_mtrx::sym_eig(). Covariance matrix is accumulated in tiles of tenors over blocks of days that fit into cache;
+     * days are split into contiguous blocks processed by worker threads, each summing its own covariance matrix.
+     *
+     */
+    class myPca
+    {
+        private:
+            std::string path;
+            std::string crv_nm;
+            std::string sep;
+            bool quotes;
+            std::vector<std::string> dates;
+            std::vector<double> yr_fracs;
+            std::vector<std::vector<double>> zrs;
+            std::vector<std::string> errs;
+            std::vector<std::vector<double>> chgs;
+            std::vector<double> means;
+            std::vector<std::vector<double>> cov;
+            std::vector<double> eig_vals;
+            std::vector<std::vector<double>> eig_vecs;
+
+            /**
+             * @brief Find dates of curves saved in "outputs/curves/" subfolder of the data folder within a date range.
+             *
+             * @param date_from First date of the range.
+             * @param date_to Last date of the range.
+             * @param date_format Format of the dates.
+             * @return std::vector<std::string> Sorted dates in yyyymmdd format.
+             */
+            std::vector<std::string> find_dates(const std::string& date_from, const std::string& date_to, const std::string& date_format) const;
+
+            /**
+             * @brief Evaluate covariance matrix of daily changes.
+             *
+             * @param threads_no Number of worker threads; 0 => number of hardware threads.
+             */
+            void set_cov(const std::size_t& threads_no);
+
+        public:
+            /**
+             * @brief Construct a new myPca object.
+             *
+             * @param path Path to data folder; report is saved into its "outputs/risk/" subfolder.
+             * @param crv_nm Curve name.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            myPca(const std::string& path, const std::string& crv_nm, const std::string& sep = ",", const bool& quotes = false) : path(path), crv_nm(crv_nm), sep(sep), quotes(quotes) {};
+
+            /**
+             * @brief Load history of zero rates onto a tenor grid from curves saved for all dates of a date range; curves are loaded by worker threads.
+             *
+             * @param date_from First date of the range.
+             * @param date_to Last date of the range.
+             * @param yr_fracs Year fractions of the tenor grid.
+             * @param threads_no Number of worker threads; 0 => number of hardware threads.
+             * @param date_format Format of the dates.
+             * @return std::size_t Number of dates successfully loaded; error messages of the other dates are available through get_errs().
+             */
+            std::size_t load(const std::string& date_from, const std::string& date_to, const std::vector<double>& yr_fracs, const std::size_t& threads_no = 0, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Load history of zero rates onto a tenor grid directly, e.g. history kept outside of the data folder.
+             *
+             * @param dates Sorted dates in yyyymmdd format.
+             * @param yr_fracs Year fractions of the tenor grid.
+             * @param zrs Zero rates; element [i][j] is zero rate of tenor j as of date i.
+             */
+            void load(const std::vector<std::string>& dates, const std::vector<double>& yr_fracs, const std::vector<std::vector<double>>& zrs);
+
+            /**
+             * @brief Decompose daily changes of the loaded history into principal components; dates which failed to load are skipped, i.e. change is taken
+             * over the gap.
+             *
+             * @param threads_no Number of worker threads evaluating covariance matrix; 0 => number of hardware threads.
+             */
+            void run(const std::size_t& threads_no = 0);
+
+            /**
+             * @brief Get dates of the loaded history.
+             *
+             * @return std::vector<std::string> Dates in yyyymmdd format.
+             */
+            std::vector<std::string> get_dates() const {return this->dates;};
+
+            /**
+             * @brief Get year fractions of the tenor grid.
+             *
+             * @return std::vector<double> Year fractions.
+             */
+            std::vector<double> get_yr_fracs() const {return this->yr_fracs;};
+
+            /**
+             * @brief Get error messages of the loaded dates.
+             *
+             * @return std::vector<std::string> Error messages in the order of dates; "" => curve was loaded.
+             */
+            std::vector<std::string> get_errs() const {return this->errs;};
+
+            /**
+             * @brief Get daily changes of zero rates of the last run, e.g. for myScenarios::add_hist().
+             *
+             * @return std::vector<std::vector<double>> Daily changes; element [i][j] is change of tenor j on i-th day.
+             */
+            std::vector<std::vector<double>> get_chgs() const {return this->chgs;};
+
+            /**
+             * @brief Get covariance matrix of daily changes of the last run.
+             *
+             * @return std::vector<std::vector<double>> Covariance matrix of tenors.
+             */
+            std::vector<std::vector<double>> get_cov() const {return this->cov;};
+
+            /**
+             * @brief Get eigenvalues of the covariance matrix, i.e. variances of the principal components.
+             *
+             * @return std::vector<double> Eigenvalues sorted in descending order.
+             */
+            std::vector<double> get_eig_vals() const {return this->eig_vals;};
+
+            /**
+             * @brief Get principal components, i.e. eigenvectors of the covariance matrix; sign of a component is chosen so that its largest loading is positive.
+             *
+             * @param comps_no Number of leading components; 0 => all components.
+             * @return std::vector<std::vector<double>> Principal components; element [i][j] is loading of tenor j in i-th component.
+             */
+            std::vector<std::vector<double>> get_eig_vecs(const std::size_t& comps_no = 0) const;
+
+            /**
+             * @brief Get share of variance of daily changes explained by principal components.
+             *
+             * @return std::vector<double> Explained variance of each component.
+             */
+            std::vector<double> get_explained() const;
+
+            /**
+             * @brief Get scores of daily changes, i.e. projections of centered daily changes onto principal components.
+             *
+             * @param comps_no Number of leading components; 0 => all components.
+             * @return std::vector<std::vector<double>> Scores; element [i][j] is score of j-th component on i-th day.
+             */
+            std::vector<std::vector<double>> get_scores(const std::size_t& comps_no = 0) const;
+
+            /**
+             * @brief Save eigenvalues, explained variance and loadings of principal components into "outputs/risk/" subfolder of the data folder.
+             *
+             * @param comps_no Number of leading components; 0 => all components.
+             */
+            void save(const std::size_t& comps_no = 0) const;
+    };
+}
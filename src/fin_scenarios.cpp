@@ -0,0 +1,235 @@
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <cmath>
+#include "lib_aux.h"
+#include "fin_curves.h"
+#include "fin_scenarios.h"
+
+// construct scenarios of a curve
+fin_curves::myScenarios::myScenarios(const std::shared_ptr<const fin_curves::myZeroRate>& crv, const std::size_t& scenarios_no)
+{
+    if ((crv == nullptr) || (crv->get_size() == 0))
+        throw std::runtime_error((std::string)__func__ + ": Zero rate curve is missing or empty!");
+    if (crv->get_def().zr_interp.compare("linear") != 0)
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + crv->get_crv_nm() + "' - only linear interpolation is supported!");
+    if (scenarios_no == 0)
+        throw std::runtime_error((std::string)__func__ + ": At least one scenario is required!");
+
+    this->crv = crv;
+    this->yr_fracs = crv->get_yr_fracs();
+    this->zr_type = crv->get_def().zr_type;
+    this->scenarios_no = scenarios_no;
+    this->reset();
+}
+
+// find the two nodes interpolating zero rate and weight of the upper node
+void fin_curves::myScenarios::find_nodes(const double& yr_frac, std::size_t& idx_lo, std::size_t& idx_hi, double& weight) const
+{
+    std::size_t nodes_no = this->yr_fracs.size();
+    if ((nodes_no == 1) || (yr_frac <= this->yr_fracs[0]))
+    {
+        idx_lo = 0;
+        idx_hi = 0;
+        weight = 0.0;
+    }
+    else if (yr_frac >= this->yr_fracs[nodes_no - 1])
+    {
+        idx_lo = nodes_no - 1;
+        idx_hi = nodes_no - 1;
+        weight = 0.0;
+    }
+    else
+    {
+        idx_hi = std::upper_bound(this->yr_fracs.begin(), this->yr_fracs.end(), yr_frac) - this->yr_fracs.begin();
+        idx_lo = idx_hi - 1;
+        weight = (yr_frac - this->yr_fracs[idx_lo]) / (this->yr_fracs[idx_hi] - this->yr_fracs[idx_lo]);
+    }
+}
+
+// check number of values
+void fin_curves::myScenarios::check_size(const std::vector<double>& values, const std::string& func_nm) const
+{
+    if (values.size() != this->scenarios_no)
+        throw std::runtime_error(func_nm + ": Number of shifts " + std::to_string(values.size()) + " does not match number of scenarios " + std::to_string(this->scenarios_no) + "!");
+}
+
+// reset scenarios to the base curve
+void fin_curves::myScenarios::reset()
+{
+    std::size_t nodes_no = this->yr_fracs.size();
+    this->zrs.resize(nodes_no * this->scenarios_no);
+    for (std::size_t idx = 0; idx < nodes_no; idx++)
+        std::fill_n(this->zrs.begin() + idx * this->scenarios_no, this->scenarios_no, this->crv->get_zr(idx));
+}
+
+// add shock of a given shape
+void fin_curves::myScenarios::add_shock(const std::vector<double>& weights, const std::vector<double>& shifts)
+{
+    if (weights.size() != this->yr_fracs.size())
+        throw std::runtime_error((std::string)__func__ + ": Number of weights " + std::to_string(weights.size()) + " does not match number of curve nodes!");
+    this->check_size(shifts, __func__);
+
+    // nodes outside of the shock are skipped; the inner loop runs over contiguous zero rates of all scenarios
+    const double* shifts_ptr = shifts.data();
+    for (std::size_t idx = 0; idx < weights.size(); idx++)
+    {
+        double weight = weights[idx];
+        if (weight == 0.0)
+            continue;
+
+        double* zrs_ptr = this->zrs.data() + idx * this->scenarios_no;
+        for (std::size_t scenario = 0; scenario < this->scenarios_no; scenario++)
+            zrs_ptr[scenario] += weight * shifts_ptr[scenario];
+    }
+}
+
+// add parallel shift
+void fin_curves::myScenarios::add_parallel(const std::vector<double>& shifts)
+{
+    this->add_shock(std::vector<double>(this->yr_fracs.size(), 1.0), shifts);
+}
+
+// add twist
+void fin_curves::myScenarios::add_twist(const double& yr_frac_short, const double& yr_frac_long, const std::vector<double>& shifts_short, const std::vector<double>& shifts_long)
+{
+    if (yr_frac_short >= yr_frac_long)
+        throw std::runtime_error((std::string)__func__ + ": Short year fraction has to be lower than long year fraction!");
+
+    // twist is a sum of a shock fading out towards the long end and a shock fading in towards the long end
+    std::vector<double> weights_long;
+    for (double yr_frac : this->yr_fracs)
+        weights_long.push_back(std::clamp((yr_frac - yr_frac_short) / (yr_frac_long - yr_frac_short), 0.0, 1.0));
+    std::vector<double> weights_short;
+    for (double weight : weights_long)
+        weights_short.push_back(1.0 - weight);
+
+    this->add_shock(weights_short, shifts_short);
+    this->add_shock(weights_long, shifts_long);
+}
+
+// add bucketed shift
+void fin_curves::myScenarios::add_bucket(const double& yr_frac_lo, const double& yr_frac_mid, const double& yr_frac_hi, const std::vector<double>& shifts)
+{
+    std::vector<double> weights;
+    for (double yr_frac : this->yr_fracs)
+    {
+        if (yr_frac <= yr_frac_mid)
+            weights.push_back((yr_frac_lo >= yr_frac_mid) ? 1.0 : std::clamp((yr_frac - yr_frac_lo) / (yr_frac_mid - yr_frac_lo), 0.0, 1.0));
+        else
+            weights.push_back((yr_frac_hi <= yr_frac_mid) ? 1.0 : std::clamp((yr_frac_hi - yr_frac) / (yr_frac_hi - yr_frac_mid), 0.0, 1.0));
+    }
+    this->add_shock(weights, shifts);
+}
+
+// add historical shifts
+void fin_curves::myScenarios::add_hist(const std::vector<double>& yr_fracs, const std::vector<std::vector<double>>& shifts)
+{
+    if (shifts.size() != this->scenarios_no)
+        throw std::runtime_error((std::string)__func__ + ": Number of historical scenarios " + std::to_string(shifts.size()) + " does not match number of scenarios " + std::to_string(this->scenarios_no) + "!");
+    for (const std::vector<double>& shifts_scenario : shifts)
+    {
+        if (shifts_scenario.size() != yr_fracs.size())
+            throw std::runtime_error((std::string)__func__ + ": Number of historical shifts does not match number of year fractions!");
+    }
+
+    // linear interpolation on the tenor grid is a sum of bucketed shifts peaking at the grid tenors
+    std::vector<double> shifts_tenor(this->scenarios_no);
+    for (std::size_t idx = 0; idx < yr_fracs.size(); idx++)
+    {
+        for (std::size_t scenario = 0; scenario < this->scenarios_no; scenario++)
+            shifts_tenor[scenario] = shifts[scenario][idx];
+        double yr_frac_lo = (idx == 0) ? yr_fracs[idx] : yr_fracs[idx - 1];
+        double yr_frac_hi = (idx == yr_fracs.size() - 1) ? yr_fracs[idx] : yr_fracs[idx + 1];
+        this->add_bucket(yr_frac_lo, yr_fracs[idx], yr_frac_hi, shifts_tenor);
+    }
+}
+
+// get zero rates of all scenarios
+void fin_curves::myScenarios::get_zrs(const double& yr_frac, double* zrs) const
+{
+    std::size_t idx_lo, idx_hi;
+    double weight;
+    this->find_nodes(yr_frac, idx_lo, idx_hi, weight);
+
+    const double* zrs_lo = this->zrs.data() + idx_lo * this->scenarios_no;
+    const double* zrs_hi = this->zrs.data() + idx_hi * this->scenarios_no;
+    for (std::size_t scenario = 0; scenario < this->scenarios_no; scenario++)
+        zrs[scenario] = zrs_lo[scenario] + (zrs_hi[scenario] - zrs_lo[scenario]) * weight;
+}
+
+// get discount factors of all scenarios
+void fin_curves::myScenarios::get_dfs(const double& yr_frac, double* dfs) const
+{
+    if (yr_frac <= 0.0)
+    {
+        std::fill_n(dfs, this->scenarios_no, 1.0);
+        return;
+    }
+
+    // interpolated zero rates are converted in place; the conversion type is resolved outside of the loop, so the loop over scenarios holds only the
+    // arithmetic of a single conversion
+    this->get_zrs(yr_frac, dfs);
+    if (this->zr_type == 0)
+    {
+        for (std::size_t scenario = 0; scenario < this->scenarios_no; scenario++)
+            dfs[scenario] = 1.0 / std::pow(1.0 + dfs[scenario], yr_frac);
+    }
+    else if (this->zr_type == 1)
+    {
+        for (std::size_t scenario = 0; scenario < this->scenarios_no; scenario++)
+            dfs[scenario] = std::exp(-dfs[scenario] * yr_frac);
+    }
+    else
+    {
+        for (std::size_t scenario = 0; scenario < this->scenarios_no; scenario++)
+            dfs[scenario] = fin_curves::zr_to_df(dfs[scenario], yr_frac, this->zr_type);
+    }
+}
+
+// get discount factors of all scenarios for a vector of year fractions
+std::vector<double> fin_curves::myScenarios::get_dfs(const std::vector<double>& yr_fracs, const std::size_t& threads_no) const
+{
+    std::vector<double> dfs(yr_fracs.size() * this->scenarios_no);
+    if (yr_fracs.size() == 0)
+        return dfs;
+
+    // number of worker threads
+    std::size_t workers_no = (threads_no > 0) ? threads_no : std::max(1u, std::thread::hardware_concurrency());
+    workers_no = std::min(workers_no, yr_fracs.size());
+
+    // worker writes only discount factors of its own block of year fractions
+    auto worker = [&](const int& idx_begin, const int& idx_end)
+    {
+        for (int idx = idx_begin; idx <= idx_end; idx++)
+            this->get_dfs(yr_fracs[idx], dfs.data() + idx * this->scenarios_no);
+    };
+
+    if (workers_no == 1)
+    {
+        worker(0, yr_fracs.size() - 1);
+        return dfs;
+    }
+
+    std::vector<std::thread> workers;
+    for (lib_aux::coordinates<int> block : lib_aux::split_vector(yr_fracs.size(), (int)workers_no))
+        workers.push_back(std::thread(worker, block.x, block.y));
+    for (std::thread& thread : workers)
+        thread.join();
+
+    return dfs;
+}
+
+// get zero rates of curve nodes in a scenario
+std::vector<double> fin_curves::myScenarios::get_node_zrs(const std::size_t& scenario) const
+{
+    if (scenario >= this->scenarios_no)
+        throw std::runtime_error((std::string)__func__ + ": Scenario " + std::to_string(scenario) + " does not exist!");
+
+    std::vector<double> zrs;
+    for (std::size_t idx = 0; idx < this->yr_fracs.size(); idx++)
+        zrs.push_back(this->zrs[idx * this->scenarios_no + scenario]);
+    return zrs;
+}
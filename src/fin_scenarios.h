@@ -0,0 +1,163 @@
+/** \example fin_scenarios_examples.h
+ * @file fin_scenarios.h
+ * @author Michal Mackanic
+ * @brief Scenarios of a zero rate curve, e.g. regulatory stress shocks, stored in a single contiguous block.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "fin_zerorate.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Scenarios of a frozen zero rate curve. Zero rates of all scenarios are stored in a single block in structure-of-arrays layout, i.e. zero rates of
+     * a curve node for all scenarios are contiguous; shocks are applied to a node for all scenarios at once and a discount factor query interpolates all
+     * scenarios by a single sweep over the two surrounding nodes. Shocks are added to zero rates of curve nodes, which are interpolated linearly; zero rates
+     * are flat beyond the first and the last node.
+     *
+     */
+    class myScenarios
+    {
+        private:
+            std::shared_ptr<const fin_curves::myZeroRate> crv;
+            std::vector<double> yr_fracs;
+            unsigned short zr_type;
+            std::size_t scenarios_no;
+            std::vector<double> zrs;
+
+            /**
+             * @brief Find curve nodes interpolating zero rate for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @param idx_lo Position index of the lower node.
+             * @param idx_hi Position index of the upper node; equal to the lower node beyond the first and the last node.
+             * @param weight Weight of the upper node.
+             */
+            void find_nodes(const double& yr_frac, std::size_t& idx_lo, std::size_t& idx_hi, double& weight) const;
+
+            /**
+             * @brief Check that a vector holds a value for each scenario.
+             *
+             * @param values Vector of values.
+             * @param func_nm Name of the calling function used in error message.
+             */
+            void check_size(const std::vector<double>& values, const std::string& func_nm) const;
+
+        public:
+            /**
+             * @brief Construct a new myScenarios object; all scenarios start as the base curve.
+             *
+             * @param crv Frozen base zero rate curve, see myZeroRate::freeze(); only linear interpolation of zero rates is supported.
+             * @param scenarios_no Number of scenarios.
+             */
+            myScenarios(const std::shared_ptr<const fin_curves::myZeroRate>& crv, const std::size_t& scenarios_no);
+
+            /**
+             * @brief Reset all scenarios to the base curve.
+             *
+             */
+            void reset();
+
+            /**
+             * @brief Add shock of a given shape scaled by scenario, i.e. zero rate of node i in scenario j is shifted by weights[i] * shifts[j]. All the shocks
+             * below are sums of such shocks.
+             *
+             * @param weights Shape of the shock, i.e. weight of each curve node.
+             * @param shifts Size of the shock in each scenario.
+             */
+            void add_shock(const std::vector<double>& weights, const std::vector<double>& shifts);
+
+            /**
+             * @brief Add parallel shift.
+             *
+             * @param shifts Shift of zero rates in each scenario, e.g. 0.0001 for +1bp.
+             */
+            void add_parallel(const std::vector<double>& shifts);
+
+            /**
+             * @brief Add twist, i.e. shift changing linearly between a short and a long year fraction and flat beyond them, e.g. steepener or flattener.
+             *
+             * @param yr_frac_short Short year fraction.
+             * @param yr_frac_long Long year fraction.
+             * @param shifts_short Shift of zero rates at the short year fraction in each scenario.
+             * @param shifts_long Shift of zero rates at the long year fraction in each scenario.
+             */
+            void add_twist(const double& yr_frac_short, const double& yr_frac_long, const std::vector<double>& shifts_short, const std::vector<double>& shifts_long);
+
+            /**
+             * @brief Add bucketed shift, i.e. triangular shift peaking at a year fraction and fading out linearly towards the neighbouring year fractions, e.g.
+             * key rate shift.
+             *
+             * @param yr_frac_lo Year fraction where the shift starts; the shift is flat before the peak if it is not lower than the peak.
+             * @param yr_frac_mid Year fraction of the peak.
+             * @param yr_frac_hi Year fraction where the shift ends; the shift is flat beyond the peak if it is not higher than the peak.
+             * @param shifts Shift of zero rates at the peak in each scenario.
+             */
+            void add_bucket(const double& yr_frac_lo, const double& yr_frac_mid, const double& yr_frac_hi, const std::vector<double>& shifts);
+
+            /**
+             * @brief Add historical shifts observed on a tenor grid; the shifts are interpolated linearly onto curve nodes and flat beyond the grid.
+             *
+             * @param yr_fracs Year fractions of the tenor grid sorted in ascending order.
+             * @param shifts Shifts of zero rates; element [i][j] is shift of tenor j in scenario i.
+             */
+            void add_hist(const std::vector<double>& yr_fracs, const std::vector<std::vector<double>>& shifts);
+
+            /**
+             * @brief Get zero rates of all scenarios for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @param zrs Array the zero rates are written into; it must hold a value for each scenario.
+             */
+            void get_zrs(const double& yr_frac, double* zrs) const;
+
+            /**
+             * @brief Get discount factors of all scenarios for a year fraction.
+             *
+             * @param yr_frac Year fraction.
+             * @param dfs Array the discount factors are written into; it must hold a value for each scenario.
+             */
+            void get_dfs(const double& yr_frac, double* dfs) const;
+
+            /**
+             * @brief Get discount factors of all scenarios for a vector of year fractions; year fractions are split into contiguous blocks processed by worker
+             * threads.
+             *
+             * @param yr_fracs Year fractions.
+             * @param threads_no Number of worker threads; 0 => number of hardware threads.
+             * @return std::vector<double> Discount factors; element [i * scenarios_no + j] is discount factor of year fraction i in scenario j.
+             */
+            std::vector<double> get_dfs(const std::vector<double>& yr_fracs, const std::size_t& threads_no = 0) const;
+
+            /**
+             * @brief Get zero rates of curve nodes in a scenario.
+             *
+             * @param scenario Position index of the scenario.
+             * @return std::vector<double> Zero rates of curve nodes.
+             */
+            std::vector<double> get_node_zrs(const std::size_t& scenario) const;
+
+            /**
+             * @brief Get number of scenarios.
+             *
+             * @return std::size_t Number of scenarios.
+             */
+            std::size_t get_scenarios_no() const {return this->scenarios_no;};
+
+            /**
+             * @brief Get the frozen base zero rate curve.
+             *
+             * @return std::shared_ptr<const fin_curves::myZeroRate> Zero rate curve.
+             */
+            std::shared_ptr<const fin_curves::myZeroRate> get_crv() const {return this->crv;};
+    };
+}
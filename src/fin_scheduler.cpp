@@ -0,0 +1,438 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include "lib_date.h"
+#include "lib_tbl.h"
+#include "fin_zerorate.h"
+#include "fin_fxcurve.h"
+#include "fin_bootstrap.h"
+#include "fin_scheduler.h"
+
+// generate myScheduler object
+fin_curves::myScheduler::myScheduler(const std::string& path, const std::string& sep, const bool& quotes)
+{
+    // store variables into the object
+    this->path = path;
+    this->sep = sep;
+    this->quotes = quotes;
+}
+
+// schedule curves stored in a .csv file
+void fin_curves::myScheduler::load(const std::string& schedule_nm)
+{
+    // read scheduled curves
+    lib_tbl::myTable schedule_tbl;
+    schedule_tbl.read(this->path + "inputs/schedules/" + schedule_nm + ".csv", this->sep, this->quotes);
+
+    // empty cells represent curves that are not needed
+    auto get_column = [&](const std::string& col_nm) -> std::vector<std::string>
+    {
+        std::vector<std::string> column;
+        for (std::shared_ptr<std::string> value : schedule_tbl.get_str_column(col_nm))
+            column.push_back((value == nullptr) ? "" : *value);
+        return column;
+    };
+
+    std::vector<std::string> crv_nms = get_column("crv_nm");
+    std::vector<std::string> dsc_crv_nms = get_column("dsc_crv_nm");
+    std::vector<std::string> fx_crv_nms = get_column("fx_crv_nm");
+    std::vector<std::string> fx_oth_crv_nms = get_column("fx_oth_crv_nm");
+    std::vector<std::string> dom_prj_crv_nms = get_column("dom_prj_crv_nm");
+    std::vector<std::string> for_prj_crv_nms = get_column("for_prj_crv_nm");
+
+    // schedule curves one by one
+    for (std::size_t idx = 0; idx < crv_nms.size(); idx++)
+    {
+        fin_curves::crv_deps crv;
+        crv.crv_nm = crv_nms[idx];
+        crv.dsc_crv_nm = dsc_crv_nms[idx];
+        crv.fx_crv_nm = fx_crv_nms[idx];
+        crv.fx_oth_crv_nm = fx_oth_crv_nms[idx];
+        crv.dom_prj_crv_nm = dom_prj_crv_nms[idx];
+        crv.for_prj_crv_nm = for_prj_crv_nms[idx];
+        this->add(crv);
+    }
+}
+
+// schedule a single zero rate curve
+void fin_curves::myScheduler::add(const fin_curves::crv_deps& crv)
+{
+    if (crv.crv_nm.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Curve name is missing!");
+
+    for (const fin_curves::crv_deps& crv_aux : this->crvs)
+    {
+        if (crv_aux.crv_nm.compare(crv.crv_nm) == 0)
+            throw std::runtime_error((std::string)__func__ + ": Curve '" + crv.crv_nm + "' is already scheduled!");
+
+        // FX curve is saved by the curve rebuilding it, so it cannot be rebuilt by two curves
+        if ((crv.fx_crv_nm.size() > 0) && (crv_aux.fx_crv_nm.compare(crv.fx_crv_nm) == 0))
+            throw std::runtime_error((std::string)__func__ + ": FX curve '" + crv.fx_crv_nm + "' is already rebuilt by curve '" + crv_aux.crv_nm + "'!");
+    }
+
+    this->crvs.push_back(crv);
+    this->handles[crv.crv_nm] = std::make_shared<fin_curves::myZeroRateHandle>();
+}
+
+// build dependency graph of scheduled curves
+std::vector<std::size_t> fin_curves::myScheduler::build_graph()
+{
+    std::size_t crvs_no = this->crvs.size();
+    std::map<std::string, std::size_t> idxs;
+    for (std::size_t idx = 0; idx < crvs_no; idx++)
+        idxs[this->crvs[idx].crv_nm] = idx;
+
+    // only scheduled curves are inputs within the graph; FX curves are rebuilt by the curves needing them
+    this->inputs.assign(crvs_no, {});
+    this->outputs.assign(crvs_no, {});
+    for (std::size_t idx = 0; idx < crvs_no; idx++)
+    {
+        const fin_curves::crv_deps& crv = this->crvs[idx];
+        for (std::string input_nm : {crv.dsc_crv_nm, crv.fx_oth_crv_nm, crv.dom_prj_crv_nm, crv.for_prj_crv_nm})
+        {
+            auto input = idxs.find(input_nm);
+            if ((input == idxs.end()) || (std::find(this->inputs[idx].begin(), this->inputs[idx].end(), input->second) != this->inputs[idx].end()))
+                continue;
+            this->inputs[idx].push_back(input->second);
+            this->outputs[input->second].push_back(idx);
+        }
+    }
+
+    // order curves so that each curve follows its inputs; curves left out of the order depend on each other
+    std::vector<std::size_t> inputs_no;
+    std::vector<std::size_t> order;
+    for (std::size_t idx = 0; idx < crvs_no; idx++)
+    {
+        inputs_no.push_back(this->inputs[idx].size());
+        if (inputs_no[idx] == 0)
+            order.push_back(idx);
+    }
+    for (std::size_t pos = 0; pos < order.size(); pos++)
+    {
+        for (std::size_t output : this->outputs[order[pos]])
+        {
+            inputs_no[output]--;
+            if (inputs_no[output] == 0)
+                order.push_back(output);
+        }
+    }
+
+    if (order.size() < crvs_no)
+    {
+        std::string crv_nms = "";
+        for (std::size_t idx = 0; idx < crvs_no; idx++)
+        {
+            if (inputs_no[idx] > 0)
+                crv_nms += ((crv_nms.size() > 0) ? "', '" : "") + this->crvs[idx].crv_nm;
+        }
+        throw std::runtime_error((std::string)__func__ + ": Curves '" + crv_nms + "' depend on each other!");
+    }
+
+    // length of the longest chain of curves waiting for each curve
+    this->depths.assign(crvs_no, 0);
+    for (auto pos = order.rbegin(); pos != order.rend(); pos++)
+    {
+        for (std::size_t output : this->outputs[*pos])
+            this->depths[*pos] = std::max(this->depths[*pos], this->depths[output] + 1);
+    }
+
+    return order;
+}
+
+// get names of scheduled curves in an order following their dependencies
+std::vector<std::string> fin_curves::myScheduler::get_order()
+{
+    std::vector<std::string> crv_nms;
+    for (std::size_t idx : this->build_graph())
+        crv_nms.push_back(this->crvs[idx].crv_nm);
+    return crv_nms;
+}
+
+// bootstrap all scheduled curves
+std::size_t fin_curves::myScheduler::run(const std::string& date, const std::size_t& threads_no, const std::string& date_format)
+{
+    // convert date to yyyymmdd if necessary
+    std::string date_str = date;
+    if (date_format.compare("yyyymmdd") != 0)
+    {
+        lib_date::myDate date_aux(date, date_format);
+        date_str = date_aux.get_date_str();
+    }
+
+    // build dependency graph; cyclic dependencies are reported before any curve is bootstrapped
+    this->build_graph();
+    std::size_t crvs_no = this->crvs.size();
+    this->errs.assign(crvs_no, "");
+    this->zr_crvs.clear();
+    this->fx_crvs.clear();
+    if (crvs_no == 0)
+        return 0;
+
+    // number of worker threads
+    std::size_t workers_no = (threads_no > 0) ? threads_no : std::max(1u, std::thread::hardware_concurrency());
+    workers_no = std::min(workers_no, crvs_no);
+
+    // curves whose inputs are all published are ready to be bootstrapped
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::size_t> inputs_no;
+    std::vector<std::size_t> ready;
+    std::size_t done_no = 0;
+    for (std::size_t idx = 0; idx < crvs_no; idx++)
+    {
+        inputs_no.push_back(this->inputs[idx].size());
+        if (inputs_no[idx] == 0)
+            ready.push_back(idx);
+    }
+
+    // bootstrap a single curve; published input curves are shared, the other input curves are loaded
+    auto bootstrap_crv = [&](const std::size_t& idx, const std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>>& crvs_published) -> std::tuple<std::shared_ptr<fin_curves::myZeroRate>, std::shared_ptr<fin_curves::myFxCurve>>
+    {
+        std::shared_ptr<fin_curves::myBootstrap> bootstrap = this->create_bootstrap(idx, date_str, crvs_published);
+        bootstrap->load(date_str);
+        bootstrap->run();
+        bootstrap->save(this->sep, this->suffix);
+        return {bootstrap->get_crv(), bootstrap->get_fx_crv()};
+    };
+
+    // name of this function for error messages raised inside the worker
+    const std::string func_nm = __func__;
+
+    // worker takes the released curve with the longest chain of curves waiting for it, bootstraps it outside of the lock, publishes it and releases
+    // curves waiting for it; curve fails if any of its inputs failed
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true)
+        {
+            cv.wait(lock, [&]() {return (ready.size() > 0) || (done_no == crvs_no);});
+            if (ready.size() == 0)
+                return;
+
+            auto next = std::max_element(ready.begin(), ready.end(), [&](const std::size_t& idx1, const std::size_t& idx2) {return this->depths[idx1] < this->depths[idx2];});
+            std::size_t idx = *next;
+            ready.erase(next);
+
+            std::string err = "";
+            std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>> crvs_published;
+            for (std::size_t input : this->inputs[idx])
+            {
+                if (this->errs[input].size() > 0)
+                    err = func_nm + ": Input curve '" + this->crvs[input].crv_nm + "' was not bootstrapped!";
+                else
+                    crvs_published[this->crvs[input].crv_nm] = this->zr_crvs[this->crvs[input].crv_nm];
+            }
+            lock.unlock();
+
+            std::shared_ptr<fin_curves::myZeroRate> crv = nullptr;
+            std::shared_ptr<fin_curves::myFxCurve> fx_crv = nullptr;
+            if (err.size() == 0)
+            {
+                try
+                {
+                    std::tie(crv, fx_crv) = bootstrap_crv(idx, crvs_published);
+                    this->handles.at(this->crvs[idx].crv_nm)->publish(*crv);
+                }
+                catch (const std::exception& e)
+                {
+                    err = e.what();
+                }
+            }
+
+            lock.lock();
+            this->errs[idx] = err;
+            if (err.size() == 0)
+            {
+                this->zr_crvs[this->crvs[idx].crv_nm] = crv;
+                if (fx_crv != nullptr)
+                    this->fx_crvs[this->crvs[idx].fx_crv_nm] = fx_crv;
+            }
+            done_no++;
+            for (std::size_t output : this->outputs[idx])
+            {
+                inputs_no[output]--;
+                if (inputs_no[output] == 0)
+                    ready.push_back(output);
+            }
+            cv.notify_all();
+        }
+    };
+
+    // run worker threads
+    std::vector<std::thread> workers;
+    for (std::size_t idx = 0; idx < workers_no; idx++)
+        workers.push_back(std::thread(worker));
+    for (std::thread& thread : workers)
+        thread.join();
+
+    // return number of successfully bootstrapped curves
+    return std::count(this->errs.begin(), this->errs.end(), "");
+}
+
+// get names of scheduled curves
+std::vector<std::string> fin_curves::myScheduler::get_crv_nms() const
+{
+    std::vector<std::string> crv_nms;
+    for (const fin_curves::crv_deps& crv : this->crvs)
+        crv_nms.push_back(crv.crv_nm);
+    return crv_nms;
+}
+
+// get zero rate curve bootstrapped by the last run
+std::shared_ptr<fin_curves::myZeroRate> fin_curves::myScheduler::get_crv(const std::string& crv_nm) const
+{
+    auto crv = this->zr_crvs.find(crv_nm);
+    if (crv == this->zr_crvs.end())
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + crv_nm + "' was not bootstrapped!");
+    return crv->second;
+}
+
+// get handle publishing snapshots of a scheduled curve
+std::shared_ptr<fin_curves::myZeroRateHandle> fin_curves::myScheduler::get_handle(const std::string& crv_nm) const
+{
+    auto handle = this->handles.find(crv_nm);
+    if (handle == this->handles.end())
+        throw std::runtime_error((std::string)__func__ + ": Curve '" + crv_nm + "' is not scheduled!");
+    return handle->second;
+}
+
+// get FX curve rebuilt by the last run
+std::shared_ptr<fin_curves::myFxCurve> fin_curves::myScheduler::get_fx_crv(const std::string& fx_crv_nm) const
+{
+    auto fx_crv = this->fx_crvs.find(fx_crv_nm);
+    if (fx_crv == this->fx_crvs.end())
+        throw std::runtime_error((std::string)__func__ + ": FX curve '" + fx_crv_nm + "' was not rebuilt!");
+    return fx_crv->second;
+}
+
+// create bootstrap of a scheduled curve with its input curves set
+std::shared_ptr<fin_curves::myBootstrap> fin_curves::myScheduler::create_bootstrap(const std::size_t& idx, const std::string& date, const std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>>& crvs_input) const
+{
+    const fin_curves::crv_deps& crv = this->crvs[idx];
+    auto get_input = [&](const std::string& crv_nm) -> std::shared_ptr<fin_curves::myZeroRate>
+    {
+        if (crv_nm.size() == 0)
+            return nullptr;
+
+        auto crv_input = crvs_input.find(crv_nm);
+        if (crv_input != crvs_input.end())
+            return crv_input->second;
+
+        std::shared_ptr<fin_curves::myZeroRate> crv_loaded = std::make_shared<fin_curves::myZeroRate>(this->path, crv_nm, this->sep, this->quotes);
+        crv_loaded->load(date, "yyyymmdd", this->sep, this->quotes);
+        return crv_loaded;
+    };
+
+    std::shared_ptr<fin_curves::myBootstrap> bootstrap = std::make_shared<fin_curves::myBootstrap>(this->path, crv.crv_nm, this->sep, this->quotes);
+    bootstrap->set_dsc_crv(get_input(crv.dsc_crv_nm));
+    bootstrap->set_prj_crvs(get_input(crv.dom_prj_crv_nm), get_input(crv.for_prj_crv_nm));
+
+    std::shared_ptr<fin_curves::myFxCurve> fx_crv = nullptr;
+    if (crv.fx_crv_nm.size() > 0)
+    {
+        auto spot = this->fx_spots.find(crv.fx_crv_nm);
+        if (spot == this->fx_spots.end())
+            throw std::runtime_error((std::string)__func__ + ": FX spot rate of FX curve '" + crv.fx_crv_nm + "' is not set!");
+        fx_crv = std::make_shared<fin_curves::myFxCurve>(this->path, crv.fx_crv_nm, this->sep, this->quotes);
+        fx_crv->set_spot(spot->second);
+    }
+    bootstrap->set_fx_crv(fx_crv, get_input(crv.fx_oth_crv_nm));
+
+    return bootstrap;
+}
+
+// create bootstrap of a scheduled curve with loaded quotes
+std::shared_ptr<fin_curves::myBootstrap> fin_curves::myScheduler::get_bootstrap(const std::string& crv_nm, const std::string& date, const std::string& date_format) const
+{
+    return this->get_bootstrap(crv_nm, date, std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>>(), date_format);
+}
+
+// create bootstrap of a scheduled curve with loaded quotes and provided input curves
+std::shared_ptr<fin_curves::myBootstrap> fin_curves::myScheduler::get_bootstrap(const std::string& crv_nm, const std::string& date, const std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>>& crvs_input, const std::string& date_format) const
+{
+    // convert date to yyyymmdd if necessary
+    std::string date_str = date;
+    if (date_format.compare("yyyymmdd") != 0)
+    {
+        lib_date::myDate date_aux(date, date_format);
+        date_str = date_aux.get_date_str();
+    }
+
+    for (std::size_t idx = 0; idx < this->crvs.size(); idx++)
+    {
+        if (this->crvs[idx].crv_nm.compare(crv_nm) != 0)
+            continue;
+
+        // provided input curves take precedence over curves bootstrapped by the last run
+        std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>> crvs = this->zr_crvs;
+        for (const auto& [input_nm, crv_input] : crvs_input)
+            crvs[input_nm] = crv_input;
+
+        std::shared_ptr<fin_curves::myBootstrap> bootstrap = this->create_bootstrap(idx, date_str, crvs);
+        bootstrap->load(date_str);
+        return bootstrap;
+    }
+
+    throw std::runtime_error((std::string)__func__ + ": Curve '" + crv_nm + "' is not scheduled!");
+}
+
+// get names of scheduled curves a scheduled curve needs
+std::vector<std::string> fin_curves::myScheduler::get_inputs(const std::string& crv_nm) const
+{
+    for (std::size_t idx = 0; idx < this->crvs.size(); idx++)
+    {
+        if (this->crvs[idx].crv_nm.compare(crv_nm) != 0)
+            continue;
+        if (this->inputs.size() != this->crvs.size())
+            throw std::runtime_error((std::string)__func__ + ": Dependency graph of curve '" + crv_nm + "' was not built; scheduler has to be run first!");
+
+        std::vector<std::string> crv_nms;
+        for (std::size_t input : this->inputs[idx])
+            crv_nms.push_back(this->crvs[input].crv_nm);
+        return crv_nms;
+    }
+
+    throw std::runtime_error((std::string)__func__ + ": Curve '" + crv_nm + "' is not scheduled!");
+}
+
+// get names of scheduled curves depending on a scheduled curve
+std::vector<std::string> fin_curves::myScheduler::get_dependents(const std::string& crv_nm) const
+{
+    for (std::size_t idx = 0; idx < this->crvs.size(); idx++)
+    {
+        if (this->crvs[idx].crv_nm.compare(crv_nm) != 0)
+            continue;
+        if (this->outputs.size() != this->crvs.size())
+            throw std::runtime_error((std::string)__func__ + ": Dependency graph of curve '" + crv_nm + "' was not built; scheduler has to be run first!");
+
+        // walk curves waiting for the curve and curves waiting for them
+        std::vector<bool> is_dependent(this->crvs.size(), false);
+        std::vector<std::size_t> dependents = this->outputs[idx];
+        for (std::size_t dependent : dependents)
+            is_dependent[dependent] = true;
+        for (std::size_t pos = 0; pos < dependents.size(); pos++)
+        {
+            for (std::size_t output : this->outputs[dependents[pos]])
+            {
+                if (is_dependent[output])
+                    continue;
+                is_dependent[output] = true;
+                dependents.push_back(output);
+            }
+        }
+
+        // curve waiting for another curve has a shorter chain of curves waiting for it, so sorting by the chain length follows dependencies
+        std::stable_sort(dependents.begin(), dependents.end(), [&](const std::size_t& idx1, const std::size_t& idx2) {return this->depths[idx1] > this->depths[idx2];});
+        std::vector<std::string> crv_nms;
+        for (std::size_t dependent : dependents)
+            crv_nms.push_back(this->crvs[dependent].crv_nm);
+        return crv_nms;
+    }
+
+    throw std::runtime_error((std::string)__func__ + ": Curve '" + crv_nm + "' is not scheduled!");
+}
@@ -0,0 +1,221 @@
+/** \example fin_scheduler_examples.h
+ * @file fin_scheduler.h
+ * @author Michal Mackanic
+ * @brief Bootstrap mutually dependent zero rate curves in parallel following their dependency graph.
+ * @version 1.0
+ * @date 2024-02-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <memory>
+#include "fin_zerorate.h"
+#include "fin_fxcurve.h"
+#include "fin_bootstrap.h"
+
+namespace fin_curves
+{
+    /**
+     * @brief Zero rate curve to be bootstrapped together with names of curves it needs; "" => curve is not needed.
+     *
+     */
+    struct crv_deps
+    {
+        std::string crv_nm;
+        std::string dsc_crv_nm = "";
+        std::string fx_crv_nm = "";
+        std::string fx_oth_crv_nm = "";
+        std::string dom_prj_crv_nm = "";
+        std::string for_prj_crv_nm = "";
+    };
+
+    /**
+     * @brief Object bootstrapping a set of zero rate curves as of a single date. Curves needed by a curve, i.e. discount, projection and other currency
+     * curves, form a dependency graph. Curves whose inputs are available are bootstrapped in parallel, each curve is published as soon as it is
+     * bootstrapped and the curves waiting for it are released. Among released curves, the one with the longest chain of curves waiting for it goes first.
+     * Input curves not scheduled are loaded from "outputs/curves/" subfolder of the data folder, i.e. they have to be bootstrapped beforehand.
+     *
+     */
+    class myScheduler
+    {
+        private:
+            std::string path;
+            std::string sep;
+            bool quotes;
+            std::string suffix = "";
+            std::vector<fin_curves::crv_deps> crvs;
+            std::map<std::string, double> fx_spots;
+            std::vector<std::vector<std::size_t>> inputs;
+            std::vector<std::vector<std::size_t>> outputs;
+            std::vector<std::size_t> depths;
+            std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>> zr_crvs;
+            std::map<std::string, std::shared_ptr<fin_curves::myFxCurve>> fx_crvs;
+            std::map<std::string, std::shared_ptr<fin_curves::myZeroRateHandle>> handles;
+            std::vector<std::string> errs;
+
+            /**
+             * @brief Build dependency graph of scheduled curves, i.e. scheduled input curves of each curve, curves waiting for each curve and length of the
+             * longest chain of curves waiting for each curve. Cyclic dependencies are not allowed.
+             *
+             * @return std::vector<std::size_t> Position indices of scheduled curves in an order following their dependencies.
+             */
+            std::vector<std::size_t> build_graph();
+
+            /**
+             * @brief Create bootstrap of a scheduled curve with its input curves set; bootstrapped input curves are shared, the other input curves are
+             * loaded from "outputs/curves/" subfolder of the data folder.
+             *
+             * @param idx Position index of the scheduled curve.
+             * @param date Date of the market quotes in yyyymmdd format.
+             * @param crvs_input Bootstrapped input curves.
+             * @return std::shared_ptr<fin_curves::myBootstrap> Bootstrap without loaded quotes.
+             */
+            std::shared_ptr<fin_curves::myBootstrap> create_bootstrap(const std::size_t& idx, const std::string& date, const std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>>& crvs_input) const;
+
+        public:
+            /**
+             * @brief Construct a new myScheduler object without any scheduled curves.
+             *
+             * @param path Path to data folder; curve definitions and quote files are expected in its "inputs/curves/" subfolder.
+             * @param sep Column separator.
+             * @param quotes true => Strings are enclosed in quotes. \n false => Strings are not enclosed in quotes.
+             */
+            myScheduler(const std::string& path, const std::string& sep = ",", const bool& quotes = false);
+
+            /**
+             * @brief Schedule curves stored in "inputs/schedules/" subfolder of the data folder with columns crv_nm, dsc_crv_nm, fx_crv_nm, fx_oth_crv_nm,
+             * dom_prj_crv_nm and for_prj_crv_nm; empty cells represent curves that are not needed.
+             *
+             * @param schedule_nm Name of the .csv file with scheduled curves.
+             */
+            void load(const std::string& schedule_nm);
+
+            /**
+             * @brief Schedule a single zero rate curve.
+             *
+             * @param crv Curve name together with names of curves it needs.
+             */
+            void add(const fin_curves::crv_deps& crv);
+
+            /**
+             * @brief Set FX spot rate of an FX curve needed by the scheduled curves.
+             *
+             * @param fx_crv_nm FX curve name.
+             * @param spot FX spot rate.
+             */
+            void set_fx_spot(const std::string& fx_crv_nm, const double& spot) {this->fx_spots[fx_crv_nm] = spot;};
+
+            /**
+             * @brief Set suffix of names of the saved curve files, e.g. "_pokus" not to overwrite curves saved by a production run; input curves not
+             * scheduled are still loaded from files without suffix.
+             *
+             * @param suffix Suffix of the file names; "" => no suffix.
+             */
+            void set_suffix(const std::string& suffix) {this->suffix = suffix;};
+
+            /**
+             * @brief Get names of scheduled curves in an order following their dependencies, i.e. each curve follows all its scheduled input curves.
+             *
+             * @return std::vector<std::string> Curve names.
+             */
+            std::vector<std::string> get_order();
+
+            /**
+             * @brief Bootstrap all scheduled curves and save their zero rates and FX forwards into "outputs/curves/" subfolder of the data folder. Failure of
+             * a curve does not stop curves independent of it; its error message is available through get_errs(). Snapshot of each bootstrapped curve is
+             * published through its handle as soon as the curve is bootstrapped.
+             *
+             * @param date Date of the market quotes.
+             * @param threads_no Number of worker threads; 0 => number of hardware threads.
+             * @param date_format Format of the date.
+             * @return std::size_t Number of successfully bootstrapped curves.
+             */
+            std::size_t run(const std::string& date, const std::size_t& threads_no = 0, const std::string& date_format = "yyyymmdd");
+
+            /**
+             * @brief Get names of scheduled curves.
+             *
+             * @return std::vector<std::string> Curve names in the order of scheduling.
+             */
+            std::vector<std::string> get_crv_nms() const;
+
+            /**
+             * @brief Get error messages of scheduled curves from the last run.
+             *
+             * @return std::vector<std::string> Error messages in the order of scheduling; "" => curve was bootstrapped successfully.
+             */
+            std::vector<std::string> get_errs() const {return this->errs;};
+
+            /**
+             * @brief Get zero rate curve bootstrapped by the last run.
+             *
+             * @param crv_nm Curve name.
+             * @return std::shared_ptr<fin_curves::myZeroRate> Zero rate curve.
+             */
+            std::shared_ptr<fin_curves::myZeroRate> get_crv(const std::string& crv_nm) const;
+
+            /**
+             * @brief Get handle publishing snapshots of a scheduled zero rate curve. The handle is kept across runs, so readers holding it see the curve
+             * bootstrapped by the latest successful run without waiting for the running one; failed curve keeps its previous snapshot.
+             *
+             * @param crv_nm Curve name.
+             * @return std::shared_ptr<fin_curves::myZeroRateHandle> Handle of the curve.
+             */
+            std::shared_ptr<fin_curves::myZeroRateHandle> get_handle(const std::string& crv_nm) const;
+
+            /**
+             * @brief Get FX curve rebuilt by the last run.
+             *
+             * @param fx_crv_nm FX curve name.
+             * @return std::shared_ptr<fin_curves::myFxCurve> FX curve.
+             */
+            std::shared_ptr<fin_curves::myFxCurve> get_fx_crv(const std::string& fx_crv_nm) const;
+
+            /**
+             * @brief Create bootstrap of a scheduled curve with loaded quotes, e.g. to bump its quotes without touching the bootstrapped curves. Input curves
+             * bootstrapped by the last run are shared, the other input curves are loaded; the bootstrap has its own curve and FX curve.
+             *
+             * @param crv_nm Curve name.
+             * @param date Date of the market quotes.
+             * @param date_format Format of the date.
+             * @return std::shared_ptr<fin_curves::myBootstrap> Bootstrap ready to be run.
+             */
+            std::shared_ptr<fin_curves::myBootstrap> get_bootstrap(const std::string& crv_nm, const std::string& date, const std::string& date_format = "yyyymmdd") const;
+
+            /**
+             * @brief Create bootstrap of a scheduled curve with loaded quotes and with the provided input curves, e.g. input curves of other bootstraps, so that
+             * a curve bumped through its bootstrap is seen by the curves depending on it. Other input curves bootstrapped by the last run are shared, the rest
+             * of input curves is loaded; the bootstrap has its own curve and FX curve.
+             *
+             * @param crv_nm Curve name.
+             * @param date Date of the market quotes.
+             * @param crvs_input Input curves identified by their names.
+             * @param date_format Format of the date.
+             * @return std::shared_ptr<fin_curves::myBootstrap> Bootstrap ready to be run.
+             */
+            std::shared_ptr<fin_curves::myBootstrap> get_bootstrap(const std::string& crv_nm, const std::string& date, const std::map<std::string, std::shared_ptr<fin_curves::myZeroRate>>& crvs_input, const std::string& date_format = "yyyymmdd") const;
+
+            /**
+             * @brief Get names of scheduled curves a scheduled curve needs, i.e. its direct inputs within the dependency graph of the last run.
+             *
+             * @param crv_nm Curve name.
+             * @return std::vector<std::string> Curve names.
+             */
+            std::vector<std::string> get_inputs(const std::string& crv_nm) const;
+
+            /**
+             * @brief Get names of scheduled curves depending on a scheduled curve directly or through other scheduled curves, i.e. curves to be bootstrapped
+             * again when the curve changes; dependency graph of the last run is used.
+             *
+             * @param crv_nm Curve name.
+             * @return std::vector<std::string> Curve names in an order following their dependencies, i.e. each curve follows all its scheduled input curves.
+             */
+            std::vector<std::string> get_dependents(const std::string& crv_nm) const;
+    };
+}
@@ -1,7 +1,15 @@
 #include <iostream>
 #include <fstream>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <mutex>
 #include "lib_math.h"
 #include "lib_tbl.h"
+#include "lib_date.h"
+#include "fin_date.h"
 #include "fin_curves.h"
 #include "fin_zerorate.h"
 
@@ -12,6 +20,7 @@ fin_curves::myZeroRate::myZeroRate(const std::string& crv_nm, const fin_curves::
     this->path = path;
     this->crv_nm = crv_nm;
     this->interp_def = interp_def;
+    this->set_interp();
 }
 
 // generate myZeroRate object using definition stored in a .csv file
@@ -32,21 +41,142 @@ fin_curves::myZeroRate::myZeroRate(const std::string& path, const std::string& c
     interp_def.zr_interp = *crv_interp_def.get_str_column("zr_interp")[0];
     interp_def.zr_type = *crv_interp_def.get_int_column("zr_type")[0];
     this->interp_def = interp_def;
+    this->set_interp();
 }
 
-// load myZeroRate object with maturity year fractions and corresponding zero rates stored in vectors.
-void fin_curves::myZeroRate::load(const std::string& date, const std::vector<double>& yr_fracs, const std::vector<double>& zrs, const std::string& date_format)
+// resolve interpolation method and precompute coefficients of curve segments
+void fin_curves::myZeroRate::set_interp()
+{
+    // interpolation method is resolved only once; unsupported method is reported once the curve is queried
+    if (this->interp_def.zr_interp.compare("linear") == 0)
+        this->interp_tp = 0;
+    else if (this->interp_def.zr_interp.compare("cubic") == 0)
+        this->interp_tp = 1;
+    else if (this->interp_def.zr_interp.compare("log_linear") == 0)
+        this->interp_tp = 2;
+    else if (this->interp_def.zr_interp.compare("monotone_convex") == 0)
+        this->interp_tp = 3;
+    else
+        this->interp_tp = -1;
+
+    // node discount factors are evaluated only once; they are kept in sync with zero rates by add() and reset()
+    this->dfs.clear();
+    for (std::size_t idx = 0; idx < this->yr_fracs.size(); idx++)
+        this->dfs.push_back(fin_curves::zr_to_df(this->zrs[idx], this->yr_fracs[idx], this->interp_def.zr_type));
+
+    this->set_coefs();
+    this->seg_last.idx.store(0, std::memory_order_relaxed);
+    this->grid = std::make_shared<fin_curves::df_grid>();
+}
+
+// precompute coefficients of all curve segments
+void fin_curves::myZeroRate::set_coefs()
+{
+    this->slopes.clear();
+    this->quads.clear();
+    this->cubes.clear();
+    this->log_dfs.clear();
+    this->mc_segs.clear();
+
+    // discount factors are interpolated through their negative logarithms; slopes are discrete forwards of the segments
+    if (this->interp_tp >= 2)
+    {
+        for (std::size_t idx = 0; idx < this->yr_fracs.size(); idx++)
+            this->log_dfs.push_back(-std::log(this->dfs[idx]));
+        for (std::size_t idx = 1; idx < this->yr_fracs.size(); idx++)
+            this->slopes.push_back((this->log_dfs[idx] - this->log_dfs[idx - 1]) / (this->yr_fracs[idx] - this->yr_fracs[idx - 1]));
+        if (this->interp_tp == 3)
+            this->set_mc_segs();
+        return;
+    }
+
+    for (std::size_t idx = 1; idx < this->yr_fracs.size(); idx++)
+        this->slopes.push_back((this->zrs[idx] - this->zrs[idx - 1]) / (this->yr_fracs[idx] - this->yr_fracs[idx - 1]));
+
+    // cubic spline is solved once for all nodes; slopes are adjusted by second derivatives at the segment ends
+    if (this->interp_tp == 1 && this->yr_fracs.size() > 1)
+    {
+        std::vector<double> derivs = lib_math::cubic_spline_derivs(this->yr_fracs, this->zrs);
+        for (std::size_t idx = 0; idx < this->slopes.size(); idx++)
+        {
+            double h = this->yr_fracs[idx + 1] - this->yr_fracs[idx];
+            this->slopes[idx] -= h * (2.0 * derivs[idx] + derivs[idx + 1]) / 6.0;
+            this->quads.push_back(derivs[idx] / 2.0);
+            this->cubes.push_back((derivs[idx + 1] - derivs[idx]) / (6.0 * h));
+        }
+    }
+}
+
+// precompute monotone convex segments
+void fin_curves::myZeroRate::set_mc_segs()
+{
+    std::size_t segs_no = this->slopes.size();
+    if (segs_no == 0)
+        return;
+
+    // instantaneous forwards at the nodes shape forwards of the adjacent segments
+    auto slope = [&](const std::size_t& idx) -> double {return this->slopes[idx];};
+    std::vector<double> fwds;
+    for (std::size_t idx = 0; idx <= segs_no; idx++)
+        fwds.push_back(fin_curves::get_mc_fwd<double>(this->yr_fracs, idx, slope));
+    for (std::size_t idx = 0; idx < segs_no; idx++)
+        this->mc_segs.push_back(fin_curves::get_mc_seg(fwds[idx] - this->slopes[idx], fwds[idx + 1] - this->slopes[idx]));
+}
+
+// evaluate negative logarithm of discount factor within a curve segment
+double fin_curves::myZeroRate::eval_log_df(const std::size_t& idx, const double& yr_frac) const
+{
+    double d = yr_frac - this->yr_fracs[idx];
+    double log_df = this->log_dfs[idx] + this->slopes[idx] * d;
+    if (this->interp_tp == 2)
+        return log_df;
+
+    // integral of g(u) over the covered part of the segment
+    double h = this->yr_fracs[idx + 1] - this->yr_fracs[idx];
+    return log_df + h * fin_curves::eval_mc_g_int(this->mc_segs[idx], d / h);
+}
+
+// evaluate zero rate within a curve segment
+double fin_curves::myZeroRate::eval_seg(const std::size_t& idx, const double& yr_frac) const
+{
+    double d = yr_frac - this->yr_fracs[idx];
+    if (this->interp_tp == 0)
+        return this->zrs[idx] + this->slopes[idx] * d;
+    else if (this->interp_tp == 1)
+        return this->zrs[idx] + d * (this->slopes[idx] + d * (this->quads[idx] + d * this->cubes[idx]));
+
+    // interpolated discount factor is converted into zero rate
+    double log_df = this->eval_log_df(idx, yr_frac);
+    if (this->interp_def.zr_type == 0)
+        return std::expm1(log_df / yr_frac);
+    else if (this->interp_def.zr_type == 1)
+        return log_df / yr_frac;
+    else
+        return fin_curves::df_to_zr(std::exp(-log_df), yr_frac, this->interp_def.zr_type);
+}
+
+// set date of zero rates
+void fin_curves::myZeroRate::set_date(const std::string& date, const std::string& date_format)
 {
     // convert date to yyyymmdd if necessary
     std::string date_str = date;
-    if (date_format.compare("yyyymmdd") == 1)
+    if (date_format.compare("yyyymmdd") != 0)
     {
         lib_date::myDate date_aux(date, date_format);
         date_str = date_aux.get_date_str();
     }
 
-    // store date into zero curve object
+    // store date into zero curve object together with its serial day number; daily discount factors are related to the date
     this->date = date_str;
+    this->date_days_no = lib_date::myDate(date_str, "yyyymmdd").get_days_no();
+    this->grid = std::make_shared<fin_curves::df_grid>();
+}
+
+// load myZeroRate object with maturity year fractions and corresponding zero rates stored in vectors.
+void fin_curves::myZeroRate::load(const std::string& date, const std::vector<double>& yr_fracs, const std::vector<double>& zrs, const std::string& date_format)
+{
+    // store date into zero curve object
+    this->set_date(date, date_format);
 
     // check that vector of year fractions has the same lenght as vector of zero rates
     if (yr_fracs.size() != zrs.size())
@@ -59,25 +189,18 @@ void fin_curves::myZeroRate::load(const std::string& date, const std::vector<dou
     this->zrs_aux.clear();
     this->zrs.clear();
     this->zrs = zrs;
+    this->set_interp();
 }
 
 // load maturity year fractions and zero rates from a .csv file
 void fin_curves::myZeroRate::load(const std::string& date, const std::string& date_format, const std::string& sep, const bool& quotes)
 {
-    // convert date to yyyymmdd if necessary
-    std::string date_str = date;
-    if (date_format.compare("yyyymmdd") == 1)
-    {
-        lib_date::myDate date_aux(date, date_format);
-        date_str = date_aux.get_date_str();
-    }
-
     // store date into zero curve object
-    this->date = date_str;
+    this->set_date(date, date_format);
 
     // prepare myTable object
     lib_tbl::myTable crv_interp_def;
-    crv_interp_def.read(this->path + "outputs/curves/" + this->crv_nm + "_" + date_str + ".csv", sep, quotes);
+    crv_interp_def.read(this->path + "outputs/curves/" + this->crv_nm + "_" + this->date + ".csv", sep, quotes);
 
     // copy year fractions and corresponding zero rates
     this->yr_fracs_aux.clear();
@@ -93,32 +216,376 @@ void fin_curves::myZeroRate::load(const std::string& date, const std::string& da
     std::tuple<std::vector<double>, std::vector<double>> aux = fin_curves::interp_rate(this->yr_fracs_aux, this->zrs_aux);
     this->yr_fracs = std::get<0>(aux);
     this->zrs = std::get<1>(aux);
+    this->set_interp();
+}
+
+// add year fraction and zero rate to the object
+void fin_curves::myZeroRate::add(const std::tuple<double, double>& yr_frac_zr)
+{
+    this->yr_fracs.push_back(std::get<0>(yr_frac_zr));
+    this->zrs.push_back(std::get<1>(yr_frac_zr));
+    this->dfs.push_back(fin_curves::zr_to_df(this->zrs.back(), this->yr_fracs.back(), this->interp_def.zr_type));
+
+    // slope of the new segment; the other interpolations depend on the preceding nodes as well
+    std::size_t nodes_no = this->yr_fracs.size();
+    if (this->interp_tp != 0)
+        this->set_coefs();
+    else if (nodes_no > 1)
+        this->slopes.push_back((this->zrs[nodes_no - 1] - this->zrs[nodes_no - 2]) / (this->yr_fracs[nodes_no - 1] - this->yr_fracs[nodes_no - 2]));
+    this->grid = std::make_shared<fin_curves::df_grid>();
+}
+
+// find curve segment containing a year fraction
+std::size_t fin_curves::myZeroRate::find_seg(const double& yr_frac) const
+{
+    // try segment of the previous query and the following one
+    std::size_t idx = this->seg_last.idx.load(std::memory_order_relaxed);
+    std::size_t segs_no = this->slopes.size();
+    if ((idx < segs_no) && (this->yr_fracs[idx] <= yr_frac))
+    {
+        if (yr_frac < this->yr_fracs[idx + 1])
+            return idx;
+        if ((idx + 1 < segs_no) && (yr_frac < this->yr_fracs[idx + 2]))
+        {
+            this->seg_last.idx.store(idx + 1, std::memory_order_relaxed);
+            return idx + 1;
+        }
+    }
+
+    // binary search
+    idx = std::upper_bound(this->yr_fracs.begin(), this->yr_fracs.end(), yr_frac) - this->yr_fracs.begin() - 1;
+    this->seg_last.idx.store(idx, std::memory_order_relaxed);
+    return idx;
 }
 
 // get zero rate for a provided maturity year fraction
 double fin_curves::myZeroRate::get_zr(const double& yr_frac) const
 {
-    // define interpolated variables
-    std::vector<double> yr_frac_aux = std::vector<double>({yr_frac});
-    std::vector<double> zr_aux;
+    // curve with a single node is flat
+    std::size_t nodes_no = this->yr_fracs.size();
+    if (nodes_no == 0)
+        throw std::runtime_error((std::string)__func__ + ": Zero rate curve '" + this->crv_nm + "' is empty!");
+    if (nodes_no == 1)
+        return this->zrs[0];
 
-    // interpolate
-    if (this->interp_def.zr_interp.compare("linear") == 0)
-        zr_aux = lib_math::lin_interp1d(this->yr_fracs, this->zrs, yr_frac_aux, false); // false => we do not extrapolate
-    else
+    // interpolate; zero rates are flat beyond the first and the last node
+    if (this->interp_tp < 0)
         throw std::runtime_error((std::string)__func__ + ": '" + this->interp_def.zr_interp + "' is not a supported interpolation!");
+    if (yr_frac <= this->yr_fracs[0])
+        return this->zrs[0];
+    if (yr_frac >= this->yr_fracs[nodes_no - 1])
+        return this->zrs[nodes_no - 1];
 
-    // return interpolated zero rate
-    return zr_aux[0];
+    return this->eval_seg(this->find_seg(yr_frac), yr_frac);
 }
 
 // get discount factor for a provided maturity year fraction
 double fin_curves::myZeroRate::get_df(const double& yr_frac) const
 {
+    // discount factors of nodes are looked up; interpolated discount factor does not need to be converted into zero rate and back
+    std::size_t nodes_no = this->yr_fracs.size();
+    if ((this->interp_tp >= 0) && (nodes_no > 1) && (yr_frac >= this->yr_fracs[0]) && (yr_frac <= this->yr_fracs[nodes_no - 1]))
+    {
+        if (yr_frac == this->yr_fracs[nodes_no - 1])
+            return this->dfs[nodes_no - 1];
+
+        std::size_t idx = this->find_seg(yr_frac);
+        if (yr_frac == this->yr_fracs[idx])
+            return this->dfs[idx];
+        if (this->interp_tp >= 2)
+            return std::exp(-this->eval_log_df(idx, yr_frac));
+        return fin_curves::zr_to_df(this->eval_seg(idx, yr_frac), yr_frac, this->interp_def.zr_type);
+    }
+
     double zr = this->get_zr(yr_frac);
     return fin_curves::zr_to_df(zr, yr_frac, this->interp_def.zr_type);
 }
 
+// get zero rates for an array of year fractions
+void fin_curves::myZeroRate::get_zrs(const double* yr_fracs, double* zrs, const std::size_t& size) const
+{
+    // curve with a single node is flat
+    std::size_t nodes_no = this->yr_fracs.size();
+    if (nodes_no == 0)
+        throw std::runtime_error((std::string)__func__ + ": Zero rate curve '" + this->crv_nm + "' is empty!");
+    if (nodes_no == 1)
+    {
+        std::fill(zrs, zrs + size, this->zrs[0]);
+        return;
+    }
+    if (this->interp_tp < 0)
+        throw std::runtime_error((std::string)__func__ + ": '" + this->interp_def.zr_interp + "' is not a supported interpolation!");
+
+    // sorted year fractions move along curve segments only forward, the other ones are searched for
+    bool is_sorted = std::is_sorted(yr_fracs, yr_fracs + size);
+    double yr_frac_first = this->yr_fracs[0];
+    double yr_frac_last = this->yr_fracs[nodes_no - 1];
+    std::size_t idx = 0;
+    for (std::size_t pos = 0; pos < size; pos++)
+    {
+        double yr_frac = yr_fracs[pos];
+        if (yr_frac <= yr_frac_first)
+            zrs[pos] = this->zrs[0];
+        else if (yr_frac >= yr_frac_last)
+            zrs[pos] = this->zrs[nodes_no - 1];
+        else
+        {
+            if (is_sorted)
+            {
+                while (this->yr_fracs[idx + 1] <= yr_frac)
+                    idx++;
+            }
+            else
+                idx = this->find_seg(yr_frac);
+            zrs[pos] = this->eval_seg(idx, yr_frac);
+        }
+    }
+}
+
+// get zero rates for a vector of year fractions
+std::vector<double> fin_curves::myZeroRate::get_zrs(const std::vector<double>& yr_fracs) const
+{
+    std::vector<double> zrs(yr_fracs.size());
+    this->get_zrs(yr_fracs.data(), zrs.data(), yr_fracs.size());
+    return zrs;
+}
+
+// get discount factors for an array of year fractions
+void fin_curves::myZeroRate::get_dfs(const double* yr_fracs, double* dfs, const std::size_t& size) const
+{
+    // year fractions are read again by the conversion, so they are copied first if the discount factors overwrite them
+    if (std::less<const double*>()(dfs, yr_fracs + size) && std::less<const double*>()(yr_fracs, dfs + size))
+    {
+        std::vector<double> yr_fracs_aux(yr_fracs, yr_fracs + size);
+        this->get_dfs(yr_fracs_aux.data(), dfs, size);
+        return;
+    }
+
+    // interpolated discount factors are evaluated directly from logarithms of discount factors of the segments, i.e. without conversion into zero
+    // rates and back; zero rates are flat beyond the first and the last node
+    std::size_t nodes_no = this->yr_fracs.size();
+    if ((this->interp_tp >= 2) && (nodes_no > 1))
+    {
+        bool is_sorted = std::is_sorted(yr_fracs, yr_fracs + size);
+        double yr_frac_first = this->yr_fracs[0];
+        double yr_frac_last = this->yr_fracs[nodes_no - 1];
+        std::size_t idx = 0;
+        for (std::size_t pos = 0; pos < size; pos++)
+        {
+            double yr_frac = yr_fracs[pos];
+            if (yr_frac <= yr_frac_first)
+                dfs[pos] = fin_curves::zr_to_df(this->zrs[0], yr_frac, this->interp_def.zr_type);
+            else if (yr_frac >= yr_frac_last)
+                dfs[pos] = (yr_frac == yr_frac_last) ? this->dfs[nodes_no - 1] : fin_curves::zr_to_df(this->zrs[nodes_no - 1], yr_frac, this->interp_def.zr_type);
+            else
+            {
+                if (is_sorted)
+                {
+                    while (this->yr_fracs[idx + 1] <= yr_frac)
+                        idx++;
+                }
+                else
+                    idx = this->find_seg(yr_frac);
+                dfs[pos] = (yr_frac == this->yr_fracs[idx]) ? this->dfs[idx] : std::exp(-this->eval_log_df(idx, yr_frac));
+            }
+        }
+        return;
+    }
+
+    // interpolated zero rates are converted into discount factors in place; the conversion type is resolved outside of the loop, but pow and exp keep
+    // the loop scalar unless the build allows vector math functions, e.g. -O3 -ffast-math
+    this->get_zrs(yr_fracs, dfs, size);
+    if (this->interp_def.zr_type == 0)
+    {
+        for (std::size_t pos = 0; pos < size; pos++)
+            dfs[pos] = 1.0 / std::pow(1.0 + dfs[pos], yr_fracs[pos]);
+    }
+    else if (this->interp_def.zr_type == 1)
+    {
+        for (std::size_t pos = 0; pos < size; pos++)
+            dfs[pos] = std::exp(-dfs[pos] * yr_fracs[pos]);
+    }
+    else
+    {
+        for (std::size_t pos = 0; pos < size; pos++)
+            dfs[pos] = fin_curves::zr_to_df(dfs[pos], yr_fracs[pos], this->interp_def.zr_type);
+    }
+}
+
+// get discount factors for a vector of year fractions
+std::vector<double> fin_curves::myZeroRate::get_dfs(const std::vector<double>& yr_fracs) const
+{
+    std::vector<double> dfs(yr_fracs.size());
+    this->get_dfs(yr_fracs.data(), dfs.data(), yr_fracs.size());
+    return dfs;
+}
+
+// evaluate daily year fractions and discount factors
+void fin_curves::myZeroRate::eval_df_grid(fin_curves::df_grid& grid) const
+{
+    if (this->date.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Date of zero rate curve '" + this->crv_nm + "' is not set!");
+    if (this->yr_fracs.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Zero rate curve '" + this->crv_nm + "' is empty!");
+
+    // year fractions of calendar days till the last curve node
+    lib_date::myDate date_begin = lib_date::myDate(this->date, "yyyymmdd");
+    lib_date::myDate date_aux = date_begin;
+    double yr_frac_last = this->yr_fracs[this->yr_fracs.size() - 1];
+    grid.yr_fracs = {0.0};
+    while (grid.yr_fracs.back() < yr_frac_last)
+    {
+        date_aux.add("1D");
+        grid.yr_fracs.push_back(fin_date::day_count_method(date_begin, date_aux, this->interp_def.zr_dcm));
+    }
+
+    // daily year fractions are sorted, so discount factors are evaluated within a single pass over curve nodes
+    grid.dfs = this->get_dfs(grid.yr_fracs);
+}
+
+// get grid of daily year fractions and discount factors
+const fin_curves::df_grid& fin_curves::myZeroRate::get_df_grid() const
+{
+    // grid is built by the first query; a failed build is repeated by the next query
+    fin_curves::df_grid& grid = *this->grid;
+    std::call_once(grid.is_built, [&]() {this->eval_df_grid(grid);});
+    return grid;
+}
+
+// get year fraction of a number of calendar days following the curve date
+double fin_curves::myZeroRate::get_yr_frac_day(const std::size_t& days_no) const
+{
+    const fin_curves::df_grid& grid = this->get_df_grid();
+    if (days_no < grid.yr_fracs.size())
+        return grid.yr_fracs[days_no];
+
+    // days beyond the last curve node; the grid holds at least the curve date
+    lib_date::myDate date_begin = lib_date::myDate(this->date, "yyyymmdd");
+    lib_date::myDate date_end = date_begin;
+    date_end.add(std::to_string(days_no) + "D");
+    return fin_date::day_count_method(date_begin, date_end, this->interp_def.zr_dcm);
+}
+
+// get discount factor for a number of calendar days following the curve date
+double fin_curves::myZeroRate::get_df_day(const std::size_t& days_no) const
+{
+    const fin_curves::df_grid& grid = this->get_df_grid();
+    if (days_no < grid.dfs.size())
+        return grid.dfs[days_no];
+
+    // zero rates beyond the last curve node are flat
+    return this->get_df(this->get_yr_frac_day(days_no));
+}
+
+// get year fraction between the curve date and a date
+double fin_curves::myZeroRate::get_yr_frac(const lib_date::myDate& date) const
+{
+    if ((this->date.size() == 0) || (date.get_days_no() < this->date_days_no))
+        throw std::runtime_error((std::string)__func__ + ": Date '" + date.get_date_str() + "' precedes date of zero rate curve '" + this->crv_nm + "'!");
+
+    return this->get_yr_frac_day(date.get_days_no() - this->date_days_no);
+}
+
+// get discount factor as of a date
+double fin_curves::myZeroRate::get_df(const lib_date::myDate& date) const
+{
+    if ((this->date.size() == 0) || (date.get_days_no() < this->date_days_no))
+        throw std::runtime_error((std::string)__func__ + ": Date '" + date.get_date_str() + "' precedes date of zero rate curve '" + this->crv_nm + "'!");
+
+    return this->get_df_day(date.get_days_no() - this->date_days_no);
+}
+
+// get discount factors for an array of dates represented by their serial day numbers
+void fin_curves::myZeroRate::get_dfs_days(const std::size_t* days_nos, double* dfs, const std::size_t& size) const
+{
+    if (this->date.size() == 0)
+        throw std::runtime_error((std::string)__func__ + ": Date of zero rate curve '" + this->crv_nm + "' is not set!");
+
+    const fin_curves::df_grid& grid = this->get_df_grid();
+    std::size_t grid_size = grid.dfs.size();
+    for (std::size_t pos = 0; pos < size; pos++)
+    {
+        if (days_nos[pos] < this->date_days_no)
+            throw std::runtime_error((std::string)__func__ + ": Serial day number " + std::to_string(days_nos[pos]) + " precedes date of zero rate curve '" + this->crv_nm + "'!");
+
+        std::size_t days_no = days_nos[pos] - this->date_days_no;
+        dfs[pos] = (days_no < grid_size) ? grid.dfs[days_no] : this->get_df_day(days_no);
+    }
+}
+
+// get discount factors for a vector of dates
+std::vector<double> fin_curves::myZeroRate::get_dfs(const std::vector<lib_date::myDate>& dates) const
+{
+    std::vector<std::size_t> days_nos;
+    for (const lib_date::myDate& date : dates)
+        days_nos.push_back(date.get_days_no());
+
+    std::vector<double> dfs(dates.size());
+    this->get_dfs_days(days_nos.data(), dfs.data(), dates.size());
+    return dfs;
+}
+
+// get forward rate between two year fractions
+double fin_curves::myZeroRate::get_fwd(const double& yr_frac_begin, const double& yr_frac_end, const unsigned short& type) const
+{
+    double yr_frac_fwd = yr_frac_end - yr_frac_begin;
+    if (yr_frac_fwd <= 0.0)
+        throw std::runtime_error((std::string)__func__ + ": Forward end " + std::to_string(yr_frac_end) + " does not follow forward start " + std::to_string(yr_frac_begin) + "!");
+
+    double df_ratio = this->get_df(yr_frac_begin) / this->get_df(yr_frac_end);
+    if (type == 0)
+        return (df_ratio - 1.0) / yr_frac_fwd;
+    else if (type == 1)
+        return std::log(df_ratio) / yr_frac_fwd;
+    else
+        throw std::runtime_error((std::string)__func__ + ": '" + std::to_string(type) + "' is not a supported compounding type!");
+}
+
+// get forward rates of contiguous periods
+void fin_curves::myZeroRate::get_fwds(const double* yr_fracs, double* fwds, const std::size_t& size, const unsigned short& type) const
+{
+    if (size == 0)
+        return;
+    if ((type != 0) && (type != 1))
+        throw std::runtime_error((std::string)__func__ + ": '" + std::to_string(type) + "' is not a supported compounding type!");
+    for (std::size_t pos = 0; pos < size; pos++)
+    {
+        if (yr_fracs[pos + 1] <= yr_fracs[pos])
+            throw std::runtime_error((std::string)__func__ + ": Period boundaries of curve '" + this->crv_nm + "' are not sorted in strictly ascending order!");
+    }
+
+    // period boundaries are read again when forwards are evaluated, so they are copied first if the forwards overwrite them
+    if (std::less<const double*>()(fwds, yr_fracs + size + 1) && std::less<const double*>()(yr_fracs, fwds + size))
+    {
+        std::vector<double> yr_fracs_aux(yr_fracs, yr_fracs + size + 1);
+        this->get_fwds(yr_fracs_aux.data(), fwds, size, type);
+        return;
+    }
+
+    // discount factors of period ends are written into the output array and replaced by forwards in place; discount factor of the period end is kept
+    // as discount factor of the following period start
+    double df_begin = this->get_df(yr_fracs[0]);
+    this->get_dfs(yr_fracs + 1, fwds, size);
+    for (std::size_t pos = 0; pos < size; pos++)
+    {
+        double df_end = fwds[pos];
+        double yr_frac_fwd = yr_fracs[pos + 1] - yr_fracs[pos];
+        fwds[pos] = (type == 0) ? (df_begin / df_end - 1.0) / yr_frac_fwd : std::log(df_begin / df_end) / yr_frac_fwd;
+        df_begin = df_end;
+    }
+}
+
+// get forward rates of contiguous periods
+std::vector<double> fin_curves::myZeroRate::get_fwds(const std::vector<double>& yr_fracs, const unsigned short& type) const
+{
+    if (yr_fracs.size() < 2)
+        return std::vector<double>();
+
+    std::vector<double> fwds(yr_fracs.size() - 1);
+    this->get_fwds(yr_fracs.data(), fwds.data(), fwds.size(), type);
+    return fwds;
+}
+
 // reset maturity year fractions and zero rates
 void fin_curves::myZeroRate::reset()
 {
@@ -126,13 +593,21 @@ void fin_curves::myZeroRate::reset()
     this->yr_fracs_aux.clear();
     this->zrs.clear();
     this->zrs_aux.clear();
+    this->dfs.clear();
+    this->slopes.clear();
+    this->quads.clear();
+    this->cubes.clear();
+    this->log_dfs.clear();
+    this->mc_segs.clear();
+    this->seg_last.idx.store(0, std::memory_order_relaxed);
+    this->grid = std::make_shared<fin_curves::df_grid>();
 }
 
 // save zero rate interpolation definition into a .csv file
 void fin_curves::myZeroRate::save_def(const std::string& sep)
 {
     // open .csv file
-    std::string file_nm = this->path + "/inputs/curves/" + this->crv_nm + ".csv";
+    std::string file_nm = this->path + "inputs/curves/" + this->crv_nm + ".csv";
     std::ofstream myfile(file_nm);
     if (myfile.is_open())
     {
@@ -161,10 +636,10 @@ void fin_curves::myZeroRate::save_def(const std::string& sep)
 }
 
 // save zero rate data into a .csv file
-void fin_curves::myZeroRate::save_data(const std::string& sep)
+void fin_curves::myZeroRate::save_data(const std::string& sep, const std::string& suffix)
 {
     // open .csv file
-    std::string file_nm = this->path + "/outputs/curves/" + this->crv_nm + "_" + this->date + "_pokus.csv";
+    std::string file_nm = this->path + "outputs/curves/" + this->crv_nm + "_" + this->date + suffix + ".csv";
     std::ofstream myfile(file_nm);
     if (myfile.is_open())
     {
@@ -178,9 +653,10 @@ void fin_curves::myZeroRate::save_data(const std::string& sep)
         }
         myfile << '\n';
 
-        // add data
+        // add data; use full precision so that the curve could be reloaded without loss
+        myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
         for (std::size_t idx = 0; idx < this->yr_fracs.size(); idx++)
-            myfile << std::to_string(this->yr_fracs[idx]) << sep << std::to_string(this->zrs[idx]) << '\n';
+            myfile << this->yr_fracs[idx] << sep << this->zrs[idx] << '\n';
 
         // close file
         myfile.close();
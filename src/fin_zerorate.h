@@ -13,12 +13,18 @@
 
 #include <iostream>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "lib_dual.h"
 #include "fin_curves.h"
 
 namespace fin_curves
 {
     /**
-     * @brief Structure describing zero rate curve interpolation.
+     * @brief Structure describing zero rate curve interpolation. Supported zr_interp values are "linear" (zero rates), "cubic" (natural cubic spline on
+     * zero rates), "log_linear" (logarithm of discount factors, i.e. piecewise flat forwards) and "monotone_convex" (Hagan-West monotone convex
+     * forwards without positivity collar).
      * 
      */
     struct zr_interp_def
@@ -29,6 +35,167 @@ namespace fin_curves
         int zr_type;
     };
 
+    /**
+     * @brief Curve segment found by the last query. It is only a hint, so it is shared by threads querying the same curve without any locking and copied
+     * together with the curve.
+     *
+     */
+    struct seg_hint
+    {
+        std::atomic<std::size_t> idx = 0;
+
+        seg_hint() = default;
+        seg_hint(const seg_hint& hint) : idx(hint.idx.load(std::memory_order_relaxed)) {};
+        seg_hint& operator=(const seg_hint& hint) {this->idx.store(hint.idx.load(std::memory_order_relaxed), std::memory_order_relaxed); return *this;};
+    };
+
+    /**
+     * @brief Year fractions and discount factors for each calendar day from the curve date till the last curve node. The grid is built only once by the
+     * first thread querying it and read by all threads afterwards.
+     *
+     */
+    struct df_grid
+    {
+        std::once_flag is_built;
+        std::vector<double> yr_fracs;
+        std::vector<double> dfs;
+    };
+
+    /**
+     * @brief Monotone convex segment. Instantaneous forward within the segment is discrete forward of the segment plus g(u), u being relative distance
+     * from the segment start; sector determines shape of g(u) with g(0) = g0 and g(1) = g1, eta and a are its break point and its extreme value.
+     *
+     * @tparam T Scalar type, e.g. double or lib_math::dual to differentiate the segment with respect to zero rates of the curve nodes.
+     */
+    template<typename T = double>
+    struct mc_seg
+    {
+        int sector = 0;
+        T g0 = 0.0;
+        T g1 = 0.0;
+        T eta = 0.0;
+        T a = 0.0;
+    };
+
+    /**
+     * @brief Get instantaneous forward of monotone convex interpolation at a curve node. Forwards at inner nodes are weighted discrete forwards of the
+     * adjacent segments; forwards at the end nodes follow from the condition that the forward of the end segment is on average equal to its discrete
+     * forward.
+     *
+     * @tparam T Scalar type, e.g. double or lib_math::dual.
+     * @tparam F Callable returning discrete forward of a segment given position index of the node starting the segment.
+     * @param yr_fracs Node year fractions; there must be at least two nodes.
+     * @param idx Position index of the node.
+     * @param slope Discrete forwards of the segments.
+     * @return T Instantaneous forward.
+     */
+    template<typename T, typename F>
+    T get_mc_fwd(const std::vector<double>& yr_fracs, const std::size_t& idx, const F& slope)
+    {
+        std::size_t segs_no = yr_fracs.size() - 1;
+        if (segs_no == 1)
+            return slope(0);
+
+        auto get_fwd_inner = [&](const std::size_t& idx_inner) -> T
+        {
+            double h_low = yr_fracs[idx_inner] - yr_fracs[idx_inner - 1];
+            double h_high = yr_fracs[idx_inner + 1] - yr_fracs[idx_inner];
+            return (h_low * slope(idx_inner) + h_high * slope(idx_inner - 1)) / (h_low + h_high);
+        };
+        if (idx == 0)
+            return slope(0) - 0.5 * (get_fwd_inner(1) - slope(0));
+        if (idx == segs_no)
+            return slope(segs_no - 1) - 0.5 * (get_fwd_inner(segs_no - 1) - slope(segs_no - 1));
+        return get_fwd_inner(idx);
+    }
+
+    /**
+     * @brief Get monotone convex segment given differences between instantaneous forwards at its ends and its discrete forward; sector of the segment
+     * determines shape of the forward so that it stays monotone and convex between the nodes.
+     *
+     * @tparam T Scalar type, e.g. double or lib_math::dual; sector is decided by values of the differences.
+     * @param g0 Instantaneous forward at the segment start less discrete forward of the segment.
+     * @param g1 Instantaneous forward at the segment end less discrete forward of the segment.
+     * @return fin_curves::mc_seg<T> Monotone convex segment.
+     */
+    template<typename T>
+    fin_curves::mc_seg<T> get_mc_seg(const T& g0, const T& g1)
+    {
+        fin_curves::mc_seg<T> seg;
+        seg.g0 = g0;
+        seg.g1 = g1;
+        double g0_val = lib_math::get_val(g0);
+        double g1_val = lib_math::get_val(g1);
+        if ((g0_val == 0.0) && (g1_val == 0.0))
+            seg.sector = 0;
+        else if (((g0_val < 0.0) && (-0.5 * g0_val <= g1_val) && (g1_val <= -2.0 * g0_val)) || ((g0_val > 0.0) && (-0.5 * g0_val >= g1_val) && (g1_val >= -2.0 * g0_val)))
+            seg.sector = 1;
+        else if (((g0_val < 0.0) && (g1_val > -2.0 * g0_val)) || ((g0_val > 0.0) && (g1_val < -2.0 * g0_val)))
+        {
+            seg.sector = 2;
+            seg.eta = (g1 + 2.0 * g0) / (g1 - g0);
+        }
+        else if (((g0_val > 0.0) && (0.0 > g1_val) && (g1_val > -0.5 * g0_val)) || ((g0_val < 0.0) && (0.0 < g1_val) && (g1_val < -0.5 * g0_val)))
+        {
+            seg.sector = 3;
+            seg.eta = 3.0 * g1 / (g1 - g0);
+        }
+        else
+        {
+            seg.sector = 4;
+            seg.eta = g1 / (g1 + g0);
+            seg.a = -g0 * g1 / (g0 + g1);
+        }
+        return seg;
+    }
+
+    /**
+     * @brief Integrate g(u) of a monotone convex segment from the segment start, i.e. the part of negative logarithm of discount factor within the segment
+     * exceeding its discrete forward, divided by length of the segment.
+     *
+     * @tparam T Scalar type, e.g. double or lib_math::dual.
+     * @param seg Monotone convex segment.
+     * @param u Relative distance from the segment start.
+     * @return T Integral of g(u).
+     */
+    template<typename T>
+    T eval_mc_g_int(const fin_curves::mc_seg<T>& seg, const double& u)
+    {
+        if (seg.sector == 0)
+            return T(0.0);
+        if (seg.sector == 1)
+            return seg.g0 * u * (1.0 - u) * (1.0 - u) - seg.g1 * u * u * (1.0 - u);
+        if (seg.sector == 2)
+        {
+            T g_int = seg.g0 * u;
+            if (u > lib_math::get_val(seg.eta))
+            {
+                T v = u - seg.eta;
+                g_int += (seg.g1 - seg.g0) * v * v * v / (3.0 * (1.0 - seg.eta) * (1.0 - seg.eta));
+            }
+            return g_int;
+        }
+
+        // sectors 3 and 4 share the part preceding the break point; sector 3 is flat at g1 behind it
+        T a = (seg.sector == 3) ? seg.g1 : seg.a;
+        T g_int = a * u;
+        if (u < lib_math::get_val(seg.eta))
+        {
+            T v = seg.eta - u;
+            g_int += (seg.g0 - a) * (seg.eta * seg.eta * seg.eta - v * v * v) / (3.0 * seg.eta * seg.eta);
+        }
+        else
+        {
+            g_int += (seg.g0 - a) * seg.eta / 3.0;
+            if (seg.sector == 4)
+            {
+                T v = u - seg.eta;
+                g_int += (seg.g1 - a) * v * v * v / (3.0 * (1.0 - seg.eta) * (1.0 - seg.eta));
+            }
+        }
+        return g_int;
+    }
+
     /**
      * @brief ZeroRate object.
      * 
@@ -39,12 +206,94 @@ namespace fin_curves
             std::string path = "--na--";
             std::string crv_nm = "--na--";
             std::string date;
+            std::size_t date_days_no = 0;
             bool quotes = false;
             std::vector<double> yr_fracs;
             std::vector<std::shared_ptr<double>> yr_fracs_aux;
             std::vector<double> zrs;
             std::vector<std::shared_ptr<double>> zrs_aux;
+            std::vector<double> dfs;
             fin_curves::zr_interp_def interp_def;
+            int interp_tp;
+            std::vector<double> slopes;
+            std::vector<double> quads;
+            std::vector<double> cubes;
+            std::vector<double> log_dfs;
+            std::vector<fin_curves::mc_seg<>> mc_segs;
+            mutable fin_curves::seg_hint seg_last;
+            std::shared_ptr<fin_curves::df_grid> grid = std::make_shared<fin_curves::df_grid>();
+
+            /**
+             * @brief Resolve interpolation method of the curve, evaluate discount factors of all nodes and precompute coefficients of all curve segments;
+             * daily discount factors are dropped.
+             *
+             */
+            void set_interp();
+
+            /**
+             * @brief Precompute coefficients of all curve segments. Zero rate within segment starting at node i reads
+             * zrs[i] + slopes[i] * d + quads[i] * d^2 + cubes[i] * d^3 with d being distance from the node; quadratic and cubic coefficients are used
+             * by cubic spline interpolation only. Interpolation of discount factors works with negative logarithms of node discount factors and slopes
+             * are discrete forwards of the segments instead.
+             *
+             */
+            void set_coefs();
+
+            /**
+             * @brief Precompute monotone convex segments from discrete forwards of the segments.
+             *
+             */
+            void set_mc_segs();
+
+            /**
+             * @brief Evaluate negative logarithm of discount factor within a curve segment; only for interpolation of discount factors.
+             *
+             * @param idx Position index of the node starting the segment.
+             * @param yr_frac Year fraction lying within the segment.
+             * @return double Negative logarithm of discount factor.
+             */
+            double eval_log_df(const std::size_t& idx, const double& yr_frac) const;
+
+            /**
+             * @brief Evaluate zero rate within a curve segment.
+             *
+             * @param idx Position index of the node starting the segment.
+             * @param yr_frac Year fraction lying within the segment.
+             * @return double Zero rate.
+             */
+            double eval_seg(const std::size_t& idx, const double& yr_frac) const;
+
+            /**
+             * @brief Evaluate year fractions and discount factors for each calendar day from the curve date till the last curve node.
+             *
+             * @param grid Grid to be filled.
+             */
+            void eval_df_grid(fin_curves::df_grid& grid) const;
+
+            /**
+             * @brief Get grid of daily year fractions and discount factors; the grid is built by the first call.
+             *
+             * @return const fin_curves::df_grid& Grid of daily year fractions and discount factors.
+             */
+            const fin_curves::df_grid& get_df_grid() const;
+
+            /**
+             * @brief Get year fraction of a number of calendar days following the curve date using day count method of the curve; days till the last curve
+             * node are looked up in the daily grid, later days are evaluated by lib_date::myDate and fin_date::day_count_method().
+             *
+             * @param days_no Number of calendar days following the curve date.
+             * @return double Year fraction.
+             */
+            double get_yr_frac_day(const std::size_t& days_no) const;
+
+            /**
+             * @brief Find curve segment containing a year fraction lying strictly between the first and the last node. Segment found by the previous query
+             * and the one following it are tried first, so that queries ordered by year fraction do not need to search.
+             *
+             * @param yr_frac Year fraction.
+             * @return std::size_t Position index of the node starting the segment.
+             */
+            std::size_t find_seg(const double& yr_frac) const;
 
         public:
             /**
@@ -66,6 +315,14 @@ namespace fin_curves
              */
             myZeroRate(const std::string& path, const std::string& crv_nm, const std::string& sep = ",", const bool& quotes = false);
 
+            /**
+             * @brief Set date of the zero rates.
+             * 
+             * @param date Date of the zero rates.
+             * @param date_format Format of the date.
+             */
+            void set_date(const std::string& date, const std::string& date_format = "yyyymmdd");
+
             /**
              * @brief Load year fractions and corresponding zero rates.
 
@@ -91,7 +348,21 @@ namespace fin_curves
              * 
              * @return std::string Curve name.
              */
-            std::string get_crv_nm(){return this->crv_nm;};
+            std::string get_crv_nm() const {return this->crv_nm;};
+
+            /**
+             * @brief Get date of the zero rates in yyyymmdd format.
+             * 
+             * @return std::string Date of the zero rates.
+             */
+            std::string get_date() const {return this->date;};
+
+            /**
+             * @brief Get path where curve definition and zero rates are stored.
+             * 
+             * @return std::string Path to data folder.
+             */
+            std::string get_path() const {return this->path;};
 
             /**
              * @brief Get the zero rate using year fraction.
@@ -123,7 +394,123 @@ namespace fin_curves
              * @param yr_frac Discount factor position index starting with 0.
              * @return double Discount factor.
              */
-            double get_df(const std::size_t& idx) const {return fin_curves::zr_to_df(this->zrs[idx], this->yr_fracs[idx], this->interp_def.zr_type);};
+            double get_df(const std::size_t& idx) const {return this->dfs[idx];};
+
+            /**
+             * @brief Get zero rates for an array of year fractions. Year fractions sorted in ascending order are located within a single pass over curve
+             * nodes.
+             *
+             * @param yr_fracs Array of year fractions.
+             * @param zrs Array the zero rates are written into; it must hold at least size elements. It might be the year fractions array itself.
+             * @param size Number of year fractions.
+             */
+            void get_zrs(const double* yr_fracs, double* zrs, const std::size_t& size) const;
+
+            /**
+             * @brief Get zero rates for a vector of year fractions.
+             *
+             * @param yr_fracs Vector of year fractions.
+             * @return std::vector<double> Zero rates.
+             */
+            std::vector<double> get_zrs(const std::vector<double>& yr_fracs) const;
+
+            /**
+             * @brief Get discount factors for an array of year fractions. Zero rates are interpolated first and then converted into discount factors within
+             * a single loop; interpolations of discount factors, i.e. log-linear and monotone convex, evaluate discount factors directly instead.
+             *
+             * @param yr_fracs Array of year fractions.
+             * @param dfs Array the discount factors are written into; it must hold at least size elements. It might be the year fractions array itself,
+             * in which case the year fractions are copied first.
+             * @param size Number of year fractions.
+             */
+            void get_dfs(const double* yr_fracs, double* dfs, const std::size_t& size) const;
+
+            /**
+             * @brief Get discount factors for a vector of year fractions.
+             *
+             * @param yr_fracs Vector of year fractions.
+             * @return std::vector<double> Discount factors.
+             */
+            std::vector<double> get_dfs(const std::vector<double>& yr_fracs) const;
+
+            /**
+             * @brief Get discount factor for a number of calendar days following the curve date. Discount factors of all calendar days from the curve date
+             * till the first day on or after the last curve node are evaluated at the first call and then only looked up, i.e. a few nanoseconds per query;
+             * the grid is shared by copies of the curve until their nodes change. Days beyond the grid fall back to lib_date::myDate and
+             * fin_date::day_count_method(), i.e. microseconds rather than nanoseconds per query.
+             *
+             * @param days_no Number of calendar days following the curve date.
+             * @return double Discount factor.
+             */
+            double get_df_day(const std::size_t& days_no) const;
+
+            /**
+             * @brief Get year fraction between the curve date and a date using day count method of the curve; year fractions of days till the last curve
+             * node are looked up in the daily grid, see get_df_day() for cost of later days.
+             *
+             * @param date Date not preceding the curve date.
+             * @return double Year fraction.
+             */
+            double get_yr_frac(const lib_date::myDate& date) const;
+
+            /**
+             * @brief Get discount factor as of a date; discount factors of dates till the last curve node are looked up in the daily grid, see get_df_day()
+             * for cost of later dates.
+             *
+             * @param date Date not preceding the curve date.
+             * @return double Discount factor.
+             */
+            double get_df(const lib_date::myDate& date) const;
+
+            /**
+             * @brief Get discount factors for an array of dates represented by their serial day numbers, see lib_date::myDate::get_days_no(); dates till
+             * the last curve node are looked up in the daily grid, see get_df_day().
+             *
+             * @param days_nos Array of serial day numbers not preceding the curve date.
+             * @param dfs Array the discount factors are written into; it must hold at least size elements.
+             * @param size Number of dates.
+             */
+            void get_dfs_days(const std::size_t* days_nos, double* dfs, const std::size_t& size) const;
+
+            /**
+             * @brief Get discount factors for a vector of dates.
+             *
+             * @param dates Vector of dates not preceding the curve date.
+             * @return std::vector<double> Discount factors.
+             */
+            std::vector<double> get_dfs(const std::vector<lib_date::myDate>& dates) const;
+
+            /**
+             * @brief Get forward rate between two year fractions; the forward accrues over the difference of the year fractions.
+             *
+             * @param yr_frac_begin Year fraction of the forward start.
+             * @param yr_frac_end Year fraction of the forward end; it must follow the forward start.
+             * @param type 0 => Simple compounding, i.e. df_begin / df_end = 1 + fwd * (yr_frac_end - yr_frac_begin). \n 1 => Continuous compounding, i.e.
+             * df_begin / df_end = exp(fwd * (yr_frac_end - yr_frac_begin)).
+             * @return double Forward rate.
+             */
+            double get_fwd(const double& yr_frac_begin, const double& yr_frac_end, const unsigned short& type = 0) const;
+
+            /**
+             * @brief Get forward rates of contiguous periods, e.g. floating leg schedule, each period starting at the end of the preceding one. Discount
+             * factors of all period boundaries are evaluated once within a single pass over curve nodes and each of them is shared by the adjacent periods.
+             *
+             * @param yr_fracs Array of size + 1 year fractions of period boundaries sorted in strictly ascending order.
+             * @param fwds Array the forward rates are written into; it must hold at least size elements. It might be the year fractions array itself, in
+             * which case the year fractions are copied first.
+             * @param size Number of periods.
+             * @param type 0 => Simple compounding. \n 1 => Continuous compounding.
+             */
+            void get_fwds(const double* yr_fracs, double* fwds, const std::size_t& size, const unsigned short& type = 0) const;
+
+            /**
+             * @brief Get forward rates of contiguous periods.
+             *
+             * @param yr_fracs Vector of year fractions of period boundaries sorted in strictly ascending order.
+             * @param type 0 => Simple compounding. \n 1 => Continuous compounding.
+             * @return std::vector<double> Forward rates; one less than the number of period boundaries.
+             */
+            std::vector<double> get_fwds(const std::vector<double>& yr_fracs, const unsigned short& type = 0) const;
 
             /**
              * @brief Get full vector of year_fractions.
@@ -132,19 +519,34 @@ namespace fin_curves
              */
             std::vector<double> get_yr_fracs() const {return this->yr_fracs;};
 
+            /**
+             * @brief Get the maturity year fraction using index.
+             * 
+             * @param idx Year fraction position index starting with 0.
+             * @return double Year fraction.
+             */
+            double get_yr_frac(const std::size_t& idx) const {return this->yr_fracs[idx];};
+
+            /**
+             * @brief Get number of curve nodes, i.e. number of maturity year fractions.
+             * 
+             * @return std::size_t Number of curve nodes.
+             */
+            std::size_t get_size() const {return this->yr_fracs.size();};
+
             /**
              * @brief Add tuple containing year fraction and zero rate to the object.
              * 
              * @param yr_frac_zr Tuple containing year fraction and zero rate.
              */
-            void add(const std::tuple<double, double>& yr_frac_zr) {this->yr_fracs.push_back(std::get<0>(yr_frac_zr)); this->zrs.push_back(std::get<1>(yr_frac_zr));};
+            void add(const std::tuple<double, double>& yr_frac_zr);
 
             /**
              * @brief Get the interpolation definition.
              * 
              * @return fin_curves::interp_def Interpolation definition.
              */
-            fin_curves::zr_interp_def get_def(){return this->interp_def;};
+            fin_curves::zr_interp_def get_def() const {return this->interp_def;};
 
             /**
              * @brief Reset vector of year fractions and zero rates.
@@ -152,6 +554,14 @@ namespace fin_curves
              */
             void reset();
 
+            /**
+             * @brief Freeze the curve, i.e. copy it into a snapshot which cannot be changed anymore. Const queries of the snapshot are safe to run from
+             * multiple threads; the curve itself has to be frozen by the thread changing it.
+             *
+             * @return std::shared_ptr<const fin_curves::myZeroRate> Frozen copy of the curve.
+             */
+            std::shared_ptr<const fin_curves::myZeroRate> freeze() const {return std::make_shared<const fin_curves::myZeroRate>(*this);};
+
             /**
              * @brief Save zero curve interpolation definition into a .csv file.
              * 
@@ -160,10 +570,59 @@ namespace fin_curves
             void save_def(const std::string& sep = ",");
 
             /**
-             * @brief Save zero curve data into a .csv file.
+             * @brief Save zero curve data into a .csv file named after curve and date, e.g. "eur_ri_3m_fo_20220531.csv", followed by a suffix.
              * 
              * @param sep Separator to be used in the .csv file.
+             * @param suffix Suffix of the file name, e.g. "_pokus" not to overwrite saved curve of the same date; "" => no suffix.
+             */
+            void save_data(const std::string& sep = ",", const std::string& suffix = "");
+    };
+
+    /**
+     * @brief Handle publishing frozen snapshots of a zero rate curve to concurrent readers. A new snapshot is frozen before it replaces the published one,
+     * so readers never wait for the curve to be rebuilt; each reader keeps the snapshot it got for as long as it needs it and the replaced snapshot is
+     * released together with its last reader. The handle is not lock-free: libstdc++ guards std::atomic<std::shared_ptr> by an internal spinlock, so
+     * get() and publish() may spin for the duration of a pointer swap or reference count update of another thread.
+     *
+     */
+    class myZeroRateHandle
+    {
+        private:
+            std::atomic<std::shared_ptr<const fin_curves::myZeroRate>> snapshot;
+
+        public:
+            /**
+             * @brief Construct a new myZeroRateHandle object without any published snapshot.
+             *
+             */
+            myZeroRateHandle() = default;
+
+            /**
+             * @brief Construct a new myZeroRateHandle object publishing a snapshot.
+             *
+             * @param snapshot Frozen zero rate curve.
+             */
+            myZeroRateHandle(const std::shared_ptr<const fin_curves::myZeroRate>& snapshot) : snapshot(snapshot) {};
+
+            /**
+             * @brief Publish a snapshot replacing the published one.
+             *
+             * @param snapshot Frozen zero rate curve.
+             */
+            void publish(const std::shared_ptr<const fin_curves::myZeroRate>& snapshot) {this->snapshot.store(snapshot, std::memory_order_release);};
+
+            /**
+             * @brief Freeze a zero rate curve and publish it replacing the published snapshot.
+             *
+             * @param crv Zero rate curve; it must not be changed by other threads while being frozen.
+             */
+            void publish(const fin_curves::myZeroRate& crv) {this->publish(crv.freeze());};
+
+            /**
+             * @brief Get the published snapshot.
+             *
+             * @return std::shared_ptr<const fin_curves::myZeroRate> Frozen zero rate curve; nullptr => no snapshot was published yet.
              */
-            void save_data(const std::string& sep = ",");
+            std::shared_ptr<const fin_curves::myZeroRate> get() const {return this->snapshot.load(std::memory_order_acquire);};
     };
 }
\ No newline at end of file
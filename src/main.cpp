@@ -3,6 +3,9 @@
 #include <memory>
 #include "lib_date.h"
 #include "fin_date.h"
+#include "lib_aux.h"
+#include "lib_str.h"
+#include "fin_bootstrap.h"
 
 int main()
 {
@@ -283,6 +286,58 @@ int main()
         std::cout << '\n' << std::endl;
     }
 
+    // bootstrap zero rate curve from quotes
+    {
+        std::cout << "BOOTSTRAP" << std::endl;
+
+        // curve definition
+        std::string path = "/home/macky/Documents/Programming/C++/FinCurves/data/";
+        std::string crv_nm = "eur_ri_3m_fo";
+        std::string date = "20220531";
+        fin_curves::myBootstrap bootstrap = fin_curves::myBootstrap(path, crv_nm);
+
+        // swaps are discounted by ESTER curve bootstrapped beforehand
+        std::shared_ptr<fin_curves::myZeroRate> dsc_crv = std::make_shared<fin_curves::myZeroRate>(path, "eur_ri_ester");
+        dsc_crv->load(date);
+        bootstrap.set_dsc_crv(dsc_crv);
+
+        // load quotes
+        std::cout << "Loading quotes..." << std::endl;
+        lib_aux::tic();
+        bootstrap.load(date);
+        std::cout << "   " << std::to_string(bootstrap.get_pillars().size()) << " pillars loaded in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+
+        // bootstrap zero rate curve
+        std::cout << "Bootstrapping curve..." << std::endl;
+        lib_aux::tic();
+        bootstrap.run();
+        std::cout << "   curve bootstrapped in " << std::to_string(lib_aux::toc()) << " seconds" << std::endl;
+
+        // print bootstrapped zero rates
+        std::vector<fin_curves::pillar> pillars = bootstrap.get_pillars();
+        std::shared_ptr<fin_curves::myZeroRate> crv = bootstrap.get_crv();
+        std::vector<double> yr_fracs = crv->get_yr_fracs();
+        std::cout << crv_nm << std::endl;
+        std::cout << lib_str::repeate_char("=", 66) << std::endl;
+        std::cout << "|tenor  " << "|generator           " << "|year fraction" << "|quote     " << "|zero rate " << "|" << std::endl;
+        std::cout << lib_str::repeate_char("=", 66) << std::endl;
+        for (std::size_t idx = 0; idx < pillars.size(); idx++)
+        {
+            std::cout << "|" << lib_str::add_trailing_char(pillars[idx].tenor, 7) << "|" << lib_str::add_trailing_char(pillars[idx].generator, 20);
+            std::cout << "|" << lib_str::add_trailing_char(std::to_string(yr_fracs[idx]), 13);
+            std::cout << "|" << lib_str::add_trailing_char(std::to_string(*pillars[idx].quote), 10);
+            std::cout << "|" << lib_str::add_trailing_char(std::to_string(crv->get_zr(idx)), 10);
+            std::cout << "|" << std::endl;
+        }
+        std::cout << lib_str::repeate_char("=", 66) << std::endl;
+
+        // store zero rates into a .csv file
+        std::cout << "Saving zero rates into a .csv file..." << std::endl;
+        bootstrap.save(",", "_pokus");
+
+        std::cout << '\n' << std::endl;
+    }
+
     // everything OK
     return 0;
 }
\ No newline at end of file